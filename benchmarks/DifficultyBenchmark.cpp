@@ -0,0 +1,91 @@
+// Rates a pack of 1000 generated puzzles with DifficultyRater, once on the
+// calling thread and once on a thread pool, and prints the spread of
+// ratings and techniques.
+#include "../src/DifficultyRater.h"
+#include "../src/PicrossHints.h"
+#include "../src/PuzzleGenerator.h"
+#include "../src/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    double millis(const std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main() {
+    ThreadPool pool;
+    std::mt19937_64 gen(12345);
+    std::uniform_int_distribution<int> sizes(5, 25);
+    std::uniform_real_distribution<double> densities(0.35, 0.75);
+
+    // Mix of logic-only puzzles and raw noise, which often needs probing or guessing
+    std::vector<PicrossHints> pack;
+    pack.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        const int size = sizes(gen);
+        const double density = densities(gen);
+        if (i % 4 == 0) {
+            std::bernoulli_distribution cell(density);
+            BitBoard board(size);
+            for (int r = 0; r < size; ++r)
+                for (int c = 0; c < size; ++c)
+                    board.set(r, c, cell(gen));
+            pack.emplace_back(board);
+        } else {
+            pack.emplace_back(PuzzleGenerator(size, density).generate(gen(), &pool).rows, size);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const auto serial = DifficultyRater::rate_all(pack);
+    const double serialMs = millis(start);
+
+    start = std::chrono::steady_clock::now();
+    const auto pooled = DifficultyRater::rate_all(pack, &pool);
+    const double pooledMs = millis(start);
+
+    for (std::size_t i = 0; i < pack.size(); ++i) {
+        if (serial[i].rating != pooled[i].rating) {
+            std::cerr << "Serial and pooled ratings differ at puzzle " << i << "\n";
+            return 1;
+        }
+    }
+
+    std::cout << "1000 puzzles: " << std::fixed << std::setprecision(1) << serialMs << "ms on 1 thread, "
+            << pooledMs << "ms on " << pool.size() << " workers\n\n";
+
+    std::array<int, 12> buckets{};
+    std::array<long, kTechniqueCount> cells{};
+    std::array<int, kTechniqueCount> hardest{};
+    for (const auto &report: serial) {
+        const auto bucket = static_cast<std::size_t>(std::clamp(report.rating, 0.0, 11.0));
+        ++buckets[bucket];
+        for (std::size_t t = 0; t < kTechniqueCount; ++t)
+            cells[t] += report.cells[t];
+        ++hardest[static_cast<std::size_t>(report.hardest())];
+    }
+
+    std::cout << "rating histogram\n";
+    for (std::size_t b = 0; b < buckets.size(); ++b) {
+        std::cout << std::setw(3) << b << (b + 1 == buckets.size() ? "+ " : "  ") << std::setw(5) << buckets[b]
+                << " " << std::string(buckets[b] / 5, '#') << "\n";
+    }
+
+    std::cout << "\n" << std::setw(12) << "technique" << std::setw(12) << "cells" << std::setw(16)
+            << "hardest needed" << "\n";
+    for (std::size_t t = 0; t < kTechniqueCount; ++t) {
+        std::cout << std::setw(12) << DifficultyRater::technique_name(static_cast<Technique>(t))
+                << std::setw(12) << cells[t] << std::setw(16) << hardest[t] << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Hit-tests random points against the clues of a 100x100 board with every
+// clue webbed, zoomed all the way out, once by scanning all visible clue
+// centres the way handleHintClick used to and once through
+// BoardLayout::clueAt, and checks they agree.
+#include "../src/BitBoard.h"
+#include "../src/BoardLayout.h"
+#include "../src/PicrossHints.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+    std::optional<ClueSlot> scan(const BoardLayout &layout, const PicrossHints &hints, sf::Vector2f point) {
+        const float radius = layout.getClueHitRadius();
+        for (const bool isRow: {true, false}) {
+            const int lines = isRow ? hints.get_row_count() : hints.get_col_count();
+            for (int line = 0; line < lines; ++line) {
+                const auto count = static_cast<int>(layout.clueCount(isRow, line));
+                for (int index = 0; index < count; ++index) {
+                    if (!hints.isWebbed(isRow, line, index) || !layout.isClueVisible(isRow, line, index))
+                        continue;
+                    const sf::Vector2f d = point - layout.clueCenter(isRow, line, index);
+                    if (d.x * d.x + d.y * d.y <= radius * radius)
+                        return ClueSlot{isRow, line, index};
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool same(const std::optional<ClueSlot> &a, const std::optional<ClueSlot> &b) {
+        if (!a || !b)
+            return a.has_value() == b.has_value();
+        return a->isRow == b->isRow && a->line == b->line && a->index == b->index;
+    }
+
+    // Hit count of the last timed run; a volatile store the optimiser has to keep
+    volatile long lastHits = 0;
+
+    template<typename F>
+    double testsPerSecond(const std::vector<sf::Vector2f> &points, int rounds, F &&hit) {
+        const auto start = std::chrono::steady_clock::now();
+        long hits = 0;
+        for (int r = 0; r < rounds; ++r)
+            for (const sf::Vector2f point: points)
+                hits += hit(point).has_value();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        lastHits = hits;
+        return static_cast<double>(points.size()) * rounds / elapsed.count();
+    }
+}
+
+int main() {
+    constexpr int size = 100;
+    std::mt19937 gen(12345);
+    std::bernoulli_distribution cell(0.5);
+    BitBoard board(size);
+    for (int r = 0; r < size; ++r)
+        for (int c = 0; c < size; ++c)
+            board.set(r, c, cell(gen));
+    PicrossHints hints(board);
+
+    BoardLayout layout;
+    layout.fit(hints, {1920, 1080});
+    layout.zoomAt({0.f, 0.f}, 0.f);
+    int webbed = 0;
+    for (const bool isRow: {true, false}) {
+        for (int line = 0; line < size; ++line) {
+            const auto count = static_cast<int>(layout.clueCount(isRow, line));
+            for (int index = 0; index < count; ++index, ++webbed)
+                hints.setWebHealth(isRow, line, index, 10);
+        }
+    }
+
+    // Half the points land on clue slots, the rest anywhere in the window
+    std::vector<sf::Vector2f> points;
+    std::uniform_real_distribution<float> jitter(-layout.getClueHitRadius(), layout.getClueHitRadius());
+    std::uniform_real_distribution<float> anyX(0.f, 1920.f);
+    std::uniform_real_distribution<float> anyY(0.f, 1080.f);
+    std::uniform_int_distribution<int> lines(0, size - 1);
+    std::bernoulli_distribution coin(0.5);
+    while (points.size() < 4096) {
+        if (coin(gen)) {
+            const bool isRow = coin(gen);
+            const int line = lines(gen);
+            const auto count = static_cast<int>(layout.clueCount(isRow, line));
+            if (count == 0)
+                continue;
+            const int index = std::uniform_int_distribution<int>(0, count - 1)(gen);
+            points.push_back(layout.clueCenter(isRow, line, index) + sf::Vector2f{jitter(gen), jitter(gen)});
+        } else {
+            points.push_back({anyX(gen), anyY(gen)});
+        }
+    }
+
+    for (const sf::Vector2f point: points) {
+        if (!same(scan(layout, hints, point), layout.clueAt(point))) {
+            std::cerr << "Scan and index disagree at (" << point.x << ", " << point.y << ")\n";
+            return 1;
+        }
+    }
+
+    const double scanned = testsPerSecond(points, 4, [&](sf::Vector2f p) { return scan(layout, hints, p); });
+    const double indexed = testsPerSecond(points, 2000, [&](sf::Vector2f p) { return layout.clueAt(p); });
+    std::cout << size << "x" << size << " board, " << webbed << " webbed clues\n"
+            << std::fixed << std::setprecision(0) << std::setw(14) << scanned << " hit-tests/s scanning\n"
+            << std::setw(14) << indexed << " hit-tests/s indexed\n"
+            << std::setprecision(1) << std::setw(14) << indexed / scanned << "x speedup\n";
+    return 0;
+}
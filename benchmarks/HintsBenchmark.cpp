@@ -0,0 +1,89 @@
+// Compares the cell-by-cell PicrossHints constructor against the word-level
+// run-length kernel (span entry point) on random boards.
+#include "../src/BitKernels.h"
+#include "../src/PicrossHints.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    struct Board {
+        std::vector<std::vector<bool> > cells;
+        std::vector<std::uint64_t> rows;
+    };
+
+    Board makeBoard(int size, std::mt19937 &gen) {
+        std::bernoulli_distribution dis(0.5);
+        const int words = BitKernels::line_words(size);
+        Board b{std::vector<std::vector<bool> >(size, std::vector<bool>(size)),
+                std::vector<std::uint64_t>(static_cast<size_t>(size) * words, 0)};
+        for (int i = 0; i < size; ++i) {
+            for (int j = 0; j < size; ++j) {
+                if (dis(gen)) {
+                    b.cells[i][j] = true;
+                    b.rows[static_cast<size_t>(i) * words + (j >> 6)] |= std::uint64_t{1} << (j & 63);
+                }
+            }
+        }
+        return b;
+    }
+
+    // Written once per timed run so the boards built in it count as used
+    volatile size_t widthSink = 0;
+
+    template<typename F>
+    double boardsPerSecond(int boards, F &&build) {
+        const auto start = std::chrono::steady_clock::now();
+        size_t sink = 0;
+        for (int k = 0; k < boards; ++k) {
+            sink += build(k).get_max_row_width();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        widthSink = sink;
+        return boards / elapsed.count();
+    }
+}
+
+int main() {
+    std::mt19937 gen(12345);
+    std::cout << std::setw(6) << "size" << std::setw(16) << "cells/s boards" << std::setw(16)
+            << "kernel boards" << std::setw(10) << "speedup" << "\n";
+
+    for (int size: {5, 16, 64, 256, 1024}) {
+        const int pool = 8;
+        const int boards = std::max(4, 2'000'000 / (size * size));
+        std::vector<Board> samples;
+        for (int k = 0; k < pool; ++k)
+            samples.push_back(makeBoard(size, gen));
+
+        // Sanity check: both paths must agree before timing them.
+        for (const auto &b: samples) {
+            PicrossHints legacy(b.cells);
+            PicrossHints packed(b.rows, size);
+            for (int line = 0; line < size; ++line) {
+                if (!std::ranges::equal(legacy.get_row(line), packed.get_row(line)) ||
+                    !std::ranges::equal(legacy.get_col(line), packed.get_col(line))) {
+                    std::cerr << "Mismatch at size " << size << "\n";
+                    return 1;
+                }
+            }
+        }
+
+        const double legacy = boardsPerSecond(boards, [&](int k) {
+            return PicrossHints(samples[k % pool].cells);
+        });
+        const double kernel = boardsPerSecond(boards, [&](int k) {
+            return PicrossHints(samples[k % pool].rows, size);
+        });
+
+        std::cout << std::setw(6) << size << std::setw(16) << std::fixed << std::setprecision(0)
+                << legacy << std::setw(16) << kernel << std::setw(9) << std::setprecision(2)
+                << kernel / legacy << "x\n";
+    }
+    return 0;
+}
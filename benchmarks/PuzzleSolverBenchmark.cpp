@@ -0,0 +1,108 @@
+// Checks the bundled levels with PuzzleSolver and times it on random boards,
+// once on the calling thread and once on a thread pool.
+#include "../src/BitKernels.h"
+#include "../src/PicrossHints.h"
+#include "../src/PuzzleSolver.h"
+#include "../src/ThreadPool.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    const char *statusName(SolveStatus status) {
+        switch (status) {
+            case SolveStatus::NoSolution: return "no solution";
+            case SolveStatus::Unique: return "unique";
+            case SolveStatus::Multiple: return "multiple";
+            case SolveStatus::GaveUp: return "gave up";
+        }
+        return "?";
+    }
+
+    // Same format as Grid::load_from_file: size, then one 0/1 string per row.
+    bool loadLevel(const std::filesystem::path &path, int &size, std::vector<std::uint64_t> &rows) {
+        std::ifstream file(path);
+        if (!(file >> size) || size <= 0)
+            return false;
+        const int words = BitKernels::line_words(size);
+        rows.assign(static_cast<size_t>(size) * words, 0);
+        std::string line;
+        for (int i = 0; i < size && file >> line; ++i) {
+            for (int j = 0; j < size && j < static_cast<int>(line.size()); ++j) {
+                if (line[j] == '1')
+                    rows[static_cast<size_t>(i) * words + (j >> 6)] |= std::uint64_t{1} << (j & 63);
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::uint64_t> randomRows(int size, double density, std::mt19937 &gen) {
+        std::bernoulli_distribution dis(density);
+        const int words = BitKernels::line_words(size);
+        std::vector<std::uint64_t> rows(static_cast<size_t>(size) * words, 0);
+        for (int i = 0; i < size; ++i)
+            for (int j = 0; j < size; ++j)
+                if (dis(gen))
+                    rows[static_cast<size_t>(i) * words + (j >> 6)] |= std::uint64_t{1} << (j & 63);
+        return rows;
+    }
+
+    double millis(const std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char **argv) {
+    const std::filesystem::path levels = argc > 1 ? argv[1] : "nivele";
+    ThreadPool pool;
+
+    if (std::filesystem::is_directory(levels)) {
+        for (const auto &entry: std::filesystem::directory_iterator(levels)) {
+            int size = 0;
+            std::vector<std::uint64_t> rows;
+            if (entry.path().extension() != ".txt" || !loadLevel(entry.path(), size, rows))
+                continue;
+            const PicrossHints hints(rows, size);
+            const SolveResult result = PuzzleSolver(hints).solve(&pool);
+            std::cout << entry.path().filename().string() << ": " << statusName(result.status)
+                    << (result.needed_guessing ? " (needs guessing)" : " (line logic only)") << "\n";
+        }
+    }
+
+    std::mt19937 gen(12345);
+    std::cout << std::setw(6) << "size" << std::setw(9) << "density" << std::setw(13) << "status"
+            << std::setw(12) << "1 thread" << std::setw(12) << "pool" << std::setw(10) << "branches" << "\n";
+    for (int size: {10, 25, 50, 100}) {
+        for (double density: {0.5, 0.6}) {
+            const PicrossHints hints(randomRows(size, density, gen), size);
+            const PuzzleSolver solver(hints);
+
+            auto start = std::chrono::steady_clock::now();
+            const SolveResult serial = solver.solve();
+            const double serialMs = millis(start);
+
+            start = std::chrono::steady_clock::now();
+            const SolveResult parallel = solver.solve(&pool);
+            const double parallelMs = millis(start);
+
+            // Either run may exhaust its budget first; definite answers must agree
+            if (serial.status != parallel.status && serial.status != SolveStatus::GaveUp &&
+                parallel.status != SolveStatus::GaveUp) {
+                std::cerr << "Serial and pooled results differ at size " << size << "\n";
+                return 1;
+            }
+            std::cout << std::setw(6) << size << std::setw(9) << density << std::setw(13)
+                    << statusName(serial.status) << std::fixed << std::setprecision(2)
+                    << std::setw(10) << serialMs << "ms" << std::setw(10) << parallelMs << "ms"
+                    << std::setw(10) << serial.branches << std::defaultfloat << "\n";
+        }
+    }
+    return 0;
+}
@@ -1,48 +1,52 @@
 #include "AlchemyMode.h"
+#include "AssetLoader.h"
 #include "GameManager.h"
 #include "Grid.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
 #include <random>
 #include <algorithm>
 
+namespace {
+constexpr const char *kSpawnSound = "assets/sound/Bow_shoot.ogg";
+
+std::string glassDigSound(int i) {
+    return "assets/sound/Glass_dig" + std::to_string(i) + ".ogg";
+}
+} // namespace
+
 AlchemyMode::AlchemyMode(std::unique_ptr<GameMode> mode) 
     : GameModeDecorator(std::move(mode)), spawnTimer(0.f), spawnInterval(2.0f), 
-      breakSound(breakBuffer), spawnSound(spawnBuffer) {
+      breakSound(breakBuffer), spawnSound(breakBuffer) {
 
     effectDisplay.loadAssets();
 
-    if (spawnBuffer.loadFromFile("assets/sound/Bow_shoot.ogg")) {
-        spawnSound.setBuffer(spawnBuffer);
+    ResourceCache& cache = ResourceCache::shared();
+    spawnBuffer = cache.optionalSoundBuffer(kSpawnSound);
+    if (spawnBuffer) {
+        spawnSound.setBuffer(*spawnBuffer);
     }
     
     glassDigBuffers.reserve(3);
     for (int i = 1; i <= 3; ++i) {
-        sf::SoundBuffer buf;
-        if (buf.loadFromFile("assets/sound/Glass_dig" + std::to_string(i) + ".ogg")) {
-            glassDigBuffers.push_back(buf);
+        if (auto buf = cache.optionalSoundBuffer(glassDigSound(i))) {
+            glassDigBuffers.push_back(std::move(buf));
         }
     }
     
-    static std::vector<sf::Texture> particleTextures;
-    if (particleTextures.empty()) { 
-
-         for (int i = 0; i <= 7; ++i) {
-             sf::Texture tex;
-             std::string path = "assets/particle/potion/effect_" + std::to_string(i) + ".png";
-             if (!tex.loadFromFile(path)) {
-                 sf::Image img; 
-                 img.resize({8, 8}, sf::Color::White); 
-                 (void)tex.loadFromImage(img);
-             }
-             particleTextures.push_back(std::move(tex));
-         }
-    }
-    
+    const TextureAtlas& atlas = TextureAtlas::game();
     potionSplashSystem.clearTextures();
-    for(const auto& t : particleTextures) {
-        potionSplashSystem.addTexture(&t);
+    for (int i = 0; i <= 7; ++i) {
+        potionSplashSystem.addFrame(atlas.region("particle/potion/effect_" + std::to_string(i)));
     }
 }
 
+void AlchemyMode::prefetch(AssetLoader& loader) {
+    loader.addSoundBuffer(kSpawnSound);
+    for (int i = 1; i <= 3; ++i)
+        loader.addSoundBuffer(glassDigSound(i));
+}
+
 void AlchemyMode::update(float deltaTime) {
     GameModeDecorator::update(deltaTime);
     
@@ -164,7 +168,7 @@ void AlchemyMode::update(float deltaTime) {
                 std::uniform_int_distribution<> dis(0, static_cast<int>(glassDigBuffers.size()) - 1);
                 
                 int idx = dis(gen);
-                breakSound.setBuffer(glassDigBuffers[idx]);
+                breakSound.setBuffer(*glassDigBuffers[idx]);
                 breakSound.play();
             }
             
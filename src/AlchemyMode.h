@@ -9,6 +9,8 @@
 #include <memory>
 #include <SFML/Audio.hpp> // Added for SoundBuffer/Sound
 
+class AssetLoader;
+
 class AlchemyMode : public GameModeDecorator {
     std::vector<std::unique_ptr<FallingItemBase>> potions;
     
@@ -22,10 +24,10 @@ class AlchemyMode : public GameModeDecorator {
     sf::SoundBuffer breakBuffer;
     sf::Sound breakSound;
     
-    sf::SoundBuffer spawnBuffer; // bow_shot when potion spawns
+    std::shared_ptr<const sf::SoundBuffer> spawnBuffer; // bow_shot when potion spawns
     sf::Sound spawnSound;
     
-    std::vector<sf::SoundBuffer> glassDigBuffers; // glass_dig1/2/3 for break
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> glassDigBuffers; // glass_dig1/2/3 for break
     
     Grid* grid{nullptr}; 
     mutable sf::Vector2u windowSize{1920, 1080}; // Track window size (mutable to update in draw)
@@ -50,6 +52,8 @@ class AlchemyMode : public GameModeDecorator {
     
 public:
     explicit AlchemyMode(std::unique_ptr<GameMode> mode);
+    // Queues the potion spawn and shatter sounds.
+    static void prefetch(AssetLoader& loader);
     
     void update(float deltaTime) override;
     void draw(sf::RenderWindow& window) const override;
@@ -0,0 +1,69 @@
+#include "AssetLoader.h"
+#include "ResourceCache.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+AssetLoader::AssetLoader(ResourceCache &cache, unsigned threads)
+    : cache(cache), pool(std::max(threads, 1u)) {}
+
+void AssetLoader::addTexture(const std::string &path, bool repeated) {
+  if (!cache.contains(path) && queued.insert(path).second)
+    jobs.push_back({path, false, repeated});
+}
+
+void AssetLoader::addSoundBuffer(const std::string &path) {
+  if (!cache.contains(path) && queued.insert(path).second)
+    jobs.push_back({path, true, false});
+}
+
+void AssetLoader::start() {
+  // Workers get their own copy of the job; jobs may grow meanwhile
+  for (; started < jobs.size(); ++started) {
+    pool.submit([this, i = started, job = jobs[started]] {
+      sf::Clock clock;
+      Decoded decoded{i, std::nullopt, nullptr, 0.f};
+      if (job.sound) {
+        auto buffer = std::make_shared<sf::SoundBuffer>();
+        if (buffer->loadFromFile(job.path))
+          decoded.sound = std::move(buffer);
+      } else {
+        sf::Image image;
+        if (image.loadFromFile(job.path))
+          decoded.image = std::move(image);
+      }
+      decoded.seconds = clock.getElapsedTime().asSeconds();
+
+      std::lock_guard lock(finishedMutex);
+      finished.push_back(std::move(decoded));
+    });
+  }
+}
+
+bool AssetLoader::poll() {
+  std::vector<Decoded> ready;
+  {
+    std::lock_guard lock(finishedMutex);
+    ready.swap(finished);
+  }
+
+  for (Decoded &decoded : ready) {
+    const Job &job = jobs[decoded.job];
+    if (decoded.sound) {
+      cache.add(job.path, std::move(decoded.sound));
+    } else if (decoded.image) {
+      auto texture = std::make_shared<sf::Texture>();
+      if (texture->loadFromImage(*decoded.image)) {
+        texture->setRepeated(job.repeated);
+        cache.add(job.path, std::move(texture));
+      }
+    } else {
+      std::cerr << "Could not preload " << job.path << std::endl;
+    }
+    timings.push_back({job.path, decoded.seconds});
+    queued.erase(job.path);
+    ++done;
+  }
+  return done == jobs.size();
+}
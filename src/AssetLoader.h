@@ -0,0 +1,86 @@
+#ifndef OOP_ASSETLOADER_H
+#define OOP_ASSETLOADER_H
+
+#include "ThreadPool.h"
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class ResourceCache;
+
+// Fills a ResourceCache ahead of time. Image and sound files are decoded
+// on worker threads; poll(), called from the thread that owns the graphics
+// context, turns finished images into textures and hands everything to
+// the cache. A file that fails to decode is only skipped here: the first
+// request for it through the cache throws as usual.
+class AssetLoader {
+public:
+  struct Timing {
+    std::string path;
+    float decodeSeconds; // on the worker, excluding texture upload
+  };
+
+  explicit AssetLoader(ResourceCache &cache,
+                       unsigned threads = std::thread::hardware_concurrency());
+
+  AssetLoader(const AssetLoader &) = delete;
+  AssetLoader &operator=(const AssetLoader &) = delete;
+
+  // Queue files; nothing is read before start(). Files already cached or
+  // still waiting to be handed over are skipped.
+  void addTexture(const std::string &path, bool repeated = false);
+  void addSoundBuffer(const std::string &path);
+
+  // Starts decoding everything queued since the last call.
+  void start();
+
+  // Uploads and caches whatever has finished decoding. Returns true once
+  // every queued file has been handled.
+  bool poll();
+
+  [[nodiscard]] bool isIdle() const { return done == jobs.size(); }
+  [[nodiscard]] std::size_t getDone() const { return done; }
+  [[nodiscard]] std::size_t getTotal() const { return jobs.size(); }
+
+  // One entry per file handled so far, in completion order.
+  [[nodiscard]] const std::vector<Timing> &getTimings() const {
+    return timings;
+  }
+
+private:
+  struct Job {
+    std::string path;
+    bool sound;
+    bool repeated;
+  };
+
+  struct Decoded {
+    std::size_t job;
+    std::optional<sf::Image> image;
+    std::shared_ptr<sf::SoundBuffer> sound;
+    float seconds;
+  };
+
+  ResourceCache &cache;
+  std::vector<Job> jobs;
+  std::unordered_set<std::string> queued; // not yet handed to the cache
+  std::size_t started = 0;
+  std::size_t done = 0;
+  std::vector<Timing> timings;
+
+  std::mutex finishedMutex;
+  std::vector<Decoded> finished; // guarded by finishedMutex
+
+  // Declared last so its workers are joined before anything they write to
+  // is destroyed.
+  ThreadPool pool;
+};
+
+#endif // OOP_ASSETLOADER_H
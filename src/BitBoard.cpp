@@ -0,0 +1,35 @@
+#include "BitBoard.h"
+#include "BitKernels.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <string>
+
+BitBoard::BitBoard(int size)
+    : n{size}, words_per_line{(size + 63) / 64} {
+  if (size < 0) {
+    throw InvalidGridException("Board size must not be negative: " +
+                               std::to_string(size));
+  }
+  bits.assign(static_cast<std::size_t>(2 * n) * words_per_line, 0);
+}
+
+BitBoard::BitBoard(int size, std::span<const std::uint64_t> rowWords)
+    : BitBoard(size) {
+  const std::size_t plane = static_cast<std::size_t>(n) * words_per_line;
+  if (rowWords.size() < plane) {
+    throw InvalidGridException("Row data too short for a board of size " +
+                               std::to_string(size));
+  }
+  std::ranges::copy(rowWords.first(plane), bits.begin());
+  BitKernels::transpose(row_words(), n, std::span(bits).subspan(plane));
+}
+
+int BitBoard::count() const {
+  int total = 0;
+  for (int r = 0; r < n; ++r)
+    total += row(r).count();
+  return total;
+}
+
+void BitBoard::clear() { std::ranges::fill(bits, 0); }
@@ -0,0 +1,118 @@
+#ifndef OOP_BITBOARD_H
+#define OOP_BITBOARD_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Read-only view over one row or column of a BitBoard.
+// Bit k of the line lives in word k / 64 at position k % 64; bits past
+// size() are always zero, so whole-word operations need no masking.
+class BitLine {
+  std::span<const std::uint64_t> bits;
+  int length = 0;
+
+public:
+  BitLine() = default;
+  BitLine(std::span<const std::uint64_t> words, int len)
+      : bits(words), length(len) {}
+
+  // Unchecked access, callers iterate [0, size()).
+  [[nodiscard]] bool operator[](int k) const {
+    return (bits[static_cast<std::size_t>(k) >> 6] >> (k & 63)) & 1u;
+  }
+
+  [[nodiscard]] int size() const { return length; }
+
+  [[nodiscard]] std::span<const std::uint64_t> words() const { return bits; }
+
+  [[nodiscard]] int count() const {
+    int total = 0;
+    for (std::uint64_t w : bits)
+      total += std::popcount(w);
+    return total;
+  }
+};
+
+// Square bit matrix stored row-major with a mirrored column-major copy, so
+// rows and columns are both contiguous runs of 64-bit words. All words live
+// in a single buffer, which makes copying a board one memcpy.
+class BitBoard {
+  int n = 0;
+  int words_per_line = 0;
+  std::vector<std::uint64_t> bits; // n rows, then n columns
+
+  [[nodiscard]] std::size_t row_offset(int r) const {
+    return static_cast<std::size_t>(r) * words_per_line;
+  }
+
+  [[nodiscard]] std::size_t col_offset(int c) const {
+    return static_cast<std::size_t>(n + c) * words_per_line;
+  }
+
+public:
+  BitBoard() = default;
+
+  explicit BitBoard(int size);
+
+  // Builds a board from row-major words (line_words() per row) and derives
+  // the column mirror with a blocked bit transpose.
+  BitBoard(int size, std::span<const std::uint64_t> rowWords);
+
+  [[nodiscard]] int size() const { return n; }
+
+  [[nodiscard]] int line_words() const { return words_per_line; }
+
+  // Unchecked accessors; bounds are the caller's responsibility.
+  [[nodiscard]] bool test(int r, int c) const {
+    return (bits[row_offset(r) + (c >> 6)] >> (c & 63)) & 1u;
+  }
+
+  void set(int r, int c, bool value) {
+    const std::uint64_t rowMask = std::uint64_t{1} << (c & 63);
+    const std::uint64_t colMask = std::uint64_t{1} << (r & 63);
+    std::uint64_t &rowWord = bits[row_offset(r) + (c >> 6)];
+    std::uint64_t &colWord = bits[col_offset(c) + (r >> 6)];
+    if (value) {
+      rowWord |= rowMask;
+      colWord |= colMask;
+    } else {
+      rowWord &= ~rowMask;
+      colWord &= ~colMask;
+    }
+  }
+
+  // Flips one cell and returns its new value.
+  bool flip(int r, int c) {
+    bits[row_offset(r) + (c >> 6)] ^= std::uint64_t{1} << (c & 63);
+    bits[col_offset(c) + (r >> 6)] ^= std::uint64_t{1} << (r & 63);
+    return test(r, c);
+  }
+
+  [[nodiscard]] BitLine row(int r) const {
+    return {std::span(bits).subspan(row_offset(r), words_per_line), n};
+  }
+
+  [[nodiscard]] BitLine col(int c) const {
+    return {std::span(bits).subspan(col_offset(c), words_per_line), n};
+  }
+
+  // All rows back to back, line_words() words each.
+  [[nodiscard]] std::span<const std::uint64_t> row_words() const {
+    return std::span(bits).first(static_cast<std::size_t>(n) * words_per_line);
+  }
+
+  [[nodiscard]] int count() const;
+
+  void clear();
+
+  [[nodiscard]] std::size_t memory_bytes() const {
+    return bits.size() * sizeof(std::uint64_t);
+  }
+
+  friend bool operator==(const BitBoard &, const BitBoard &) = default;
+};
+
+#endif // OOP_BITBOARD_H
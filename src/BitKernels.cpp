@@ -0,0 +1,96 @@
+#include "BitKernels.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace BitKernels {
+    void extract_runs(std::span<const std::uint64_t> line, std::vector<int> &out) {
+        int run = 0;
+        for (std::uint64_t word: line) {
+            int bit = 0;
+            while (bit < 64) {
+                const std::uint64_t rest = word >> bit;
+                if (run > 0 || (rest & 1u)) {
+                    // Inside a run: consume all consecutive ones at once.
+                    // The run may continue into the next word.
+                    const int ones = std::countr_one(rest);
+                    run += ones;
+                    bit += ones;
+                    if (bit < 64) {
+                        out.push_back(run);
+                        run = 0;
+                    }
+                } else {
+                    if (rest == 0)
+                        break;
+                    bit += std::countr_zero(rest);
+                }
+            }
+        }
+        if (run > 0)
+            out.push_back(run);
+    }
+
+    void transpose64(std::span<std::uint64_t, 64> block) {
+        // Swap the off-diagonal 32x32 quadrants, then 16x16 blocks inside
+        // them, and so on down to single bits (the last three rounds are
+        // the classic 8x8 byte transpose).
+        std::uint64_t mask = 0x00000000FFFFFFFFull;
+        for (int j = 32; j != 0; j >>= 1, mask ^= (mask << j)) {
+            for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                const std::uint64_t t = ((block[k] >> j) ^ block[k | j]) & mask;
+                block[k] ^= t << j;
+                block[k | j] ^= t;
+            }
+        }
+    }
+
+    std::uint64_t transpose8(std::uint64_t x) {
+        std::uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+        x ^= t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+        x ^= t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+        x ^= t ^ (t << 28);
+        return x;
+    }
+
+    void transpose(std::span<const std::uint64_t> rows, int size,
+                   std::span<std::uint64_t> cols) {
+        if (size <= 8) {
+            // Small boards fit in a single 8x8 block: one word, three rounds.
+            std::uint64_t block = 0;
+            for (int r = 0; r < size; ++r) {
+                block |= (rows[r] & 0xFFu) << (8 * r);
+            }
+            block = transpose8(block);
+            for (int c = 0; c < size; ++c) {
+                cols[c] = (block >> (8 * c)) & 0xFFu;
+            }
+            return;
+        }
+
+        const int words = line_words(size);
+        std::array<std::uint64_t, 64> tile{};
+        for (int bi = 0; bi < words; ++bi) {
+            const int rowBegin = bi * 64;
+            const int rowCount = std::min(64, size - rowBegin);
+            for (int bj = 0; bj < words; ++bj) {
+                for (int r = 0; r < rowCount; ++r) {
+                    tile[r] = rows[static_cast<std::size_t>(rowBegin + r) * words + bj];
+                }
+                for (int r = rowCount; r < 64; ++r) {
+                    tile[r] = 0;
+                }
+                transpose64(tile);
+
+                const int colBegin = bj * 64;
+                const int colCount = std::min(64, size - colBegin);
+                for (int c = 0; c < colCount; ++c) {
+                    cols[static_cast<std::size_t>(colBegin + c) * words + bi] = tile[c];
+                }
+            }
+        }
+    }
+}
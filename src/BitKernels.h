@@ -0,0 +1,31 @@
+#ifndef OOP_BITKERNELS_H
+#define OOP_BITKERNELS_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Word-level helpers for bit-packed boards. A line is a run of 64-bit words
+// where bit k of the line is bit k % 64 of word k / 64; bits past the end of
+// the line must be zero.
+namespace BitKernels {
+    // Appends the lengths of the runs of set bits, in line order, to out.
+    // Uses count-trailing-zeros/ones to skip whole gaps and runs at a time.
+    void extract_runs(std::span<const std::uint64_t> line, std::vector<int> &out);
+
+    // In-place transpose of a 64x64 bit block: afterwards bit r of word c
+    // holds what was bit c of word r.
+    void transpose64(std::span<std::uint64_t, 64> block);
+
+    // Transpose of an 8x8 bit block packed in one word, byte r being row r.
+    std::uint64_t transpose8(std::uint64_t block);
+
+    // Transposes a size x size bit matrix stored as rows of line_words(size)
+    // words each into the same layout by columns.
+    void transpose(std::span<const std::uint64_t> rows, int size,
+                   std::span<std::uint64_t> cols);
+
+    constexpr int line_words(int size) { return (size + 63) / 64; }
+}
+
+#endif // OOP_BITKERNELS_H
@@ -5,19 +5,8 @@
 #include "Block.h"
 #include <ostream>
 
-Block::Block(bool correct_val) : correct{correct_val}, completed{false} {}
-
-Block::Block(const Block& other) : correct{other.correct}, completed{other.completed} {}
-
-Block& Block::operator=(const Block& other) {
-    if (this != &other) {
-        correct = other.correct;
-        completed = other.completed;
-    }
-    return *this;
-}
-
-Block::~Block() = default;
+Block::Block(bool correct_val, bool completed_val, bool crossed_val)
+    : correct{correct_val}, completed{completed_val}, crossed{crossed_val} {}
 
 void Block::toggle() { completed = !completed; }
 
@@ -25,7 +14,9 @@ bool Block::is_correct() const { return correct; }
 
 bool Block::is_completed() const { return completed; }
 
+bool Block::is_crossed() const { return crossed; }
+
 std::ostream& operator<<(std::ostream& os, const Block& b) {
-    os << (b.completed ? "#" : ".");
+    os << (b.completed ? "#" : b.crossed ? "x" : ".");
     return os;
 }
\ No newline at end of file
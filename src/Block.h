@@ -7,19 +7,21 @@
 
 #include <iosfwd>
 
+// Value snapshot of one cell. The board itself is stored bit-packed in
+// Grid, so blocks are built on demand and are trivially copyable.
 class Block {
     bool correct;
     bool completed;
+    bool crossed;
 
 public:
-    explicit Block(bool correct_val);
-    Block(const Block& other);
-    Block& operator=(const Block& other);
-    ~Block();
+    explicit Block(bool correct_val, bool completed_val = false,
+                   bool crossed_val = false);
 
     void toggle();
     [[nodiscard]] bool is_correct() const;
     [[nodiscard]] bool is_completed() const;
+    [[nodiscard]] bool is_crossed() const;
 
     friend std::ostream& operator<<(std::ostream& os, const Block& b);
 };
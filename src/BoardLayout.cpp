@@ -0,0 +1,249 @@
+#include "BoardLayout.h"
+
+#include <algorithm>
+#include <cmath>
+
+void BoardLayout::fit(const PicrossHints &hints, sf::Vector2u window) {
+  windowSize = window;
+  size = hints.get_row_count();
+  const auto n = static_cast<float>(size);
+  const auto width = static_cast<float>(window.x);
+  const auto height = static_cast<float>(window.y);
+  uiScale = std::min(width / 1280.0f, height / 720.0f);
+  clueGap = 16.0f * uiScale;
+
+  lineClueStart.assign(1, 0);
+  for (int i = 0; i < hints.get_row_count(); ++i)
+    lineClueStart.push_back(lineClueStart.back() +
+                            static_cast<std::uint32_t>(hints.get_row(i).size()));
+  for (int j = 0; j < hints.get_col_count(); ++j)
+    lineClueStart.push_back(lineClueStart.back() +
+                            static_cast<std::uint32_t>(hints.get_col(j).size()));
+
+  // Clues take 0.8 of a cell per number; leave room for them on both sides
+  // so the grid itself stays centred.
+  maxRowWidth = hints.get_max_row_width();
+  maxColHeight = hints.get_max_col_height();
+  const float cellSizeByWidth =
+      width * 0.95f / (n + static_cast<float>(maxRowWidth) * 0.8f * 2.0f);
+  const float cellSizeByHeight =
+      height * 0.95f / (n + static_cast<float>(maxColHeight) * 0.8f * 2.0f);
+  cellSize = std::min(cellSizeByWidth, cellSizeByHeight);
+
+  camera = size >= kCameraMinSize;
+  pan = {0.f, 0.f};
+  if (camera) {
+    // Zooming out stops where the whole board would have fitted anyway
+    minCellSize = cellSize;
+    maxCellSize = std::max(cellSize, 64.0f * uiScale);
+    cellSize = std::clamp(28.0f * uiScale, minCellSize, maxCellSize);
+  }
+  place();
+}
+
+void BoardLayout::place() {
+  const auto width = static_cast<float>(windowSize.x);
+  const auto height = static_cast<float>(windowSize.y);
+  const float gridExtent = static_cast<float>(size) * cellSize;
+  slotHeight = cellSize * 0.8f;
+  const float rowHintsWidth = static_cast<float>(maxRowWidth) * slotHeight;
+  const float colHintsHeight = static_cast<float>(maxColHeight) * slotHeight;
+
+  if (!camera) {
+    origin = {(width - gridExtent) / 2.f - rowHintsWidth,
+              (height - gridExtent) / 2.f - colHintsHeight + 25.0f};
+    gridOrigin = {origin.x + rowHintsWidth, origin.y + colHintsHeight};
+    viewport = {gridOrigin, {gridExtent, gridExtent}};
+    minimap = {};
+  } else {
+    // The clue strips get at most a third of the window each; clues too
+    // far from the grid to fit are not shown.
+    clueStrip = {std::min(rowHintsWidth, width / 3.f),
+                 std::min(colHintsHeight, height / 3.f)};
+    const sf::Vector2f margin = {width * 0.025f, height * 0.025f};
+    origin = {margin.x, margin.y + 25.0f};
+    const sf::Vector2f corner = origin + clueStrip;
+    const sf::Vector2f shown = {
+        std::min(gridExtent, width - margin.x - corner.x),
+        std::min(gridExtent, height - margin.y - corner.y)};
+    pan = {std::clamp(pan.x, 0.f, gridExtent - shown.x),
+           std::clamp(pan.y, 0.f, gridExtent - shown.y)};
+    viewport = {corner, shown};
+    gridOrigin = corner - pan;
+
+    const float inCorner = std::min(clueStrip.x, clueStrip.y) - clueGap;
+    if (inCorner >= 64.0f * uiScale) {
+      minimap = {corner - sf::Vector2f{inCorner, inCorner} -
+                     sf::Vector2f{clueGap, clueGap} / 2.f,
+                 {inCorner, inCorner}};
+    } else {
+      const float side = 160.0f * uiScale;
+      minimap = {corner + shown - sf::Vector2f{side, side} -
+                     sf::Vector2f{8.0f, 8.0f} * uiScale,
+                 {side, side}};
+    }
+  }
+
+  columnX.resize(static_cast<std::size_t>(size) + 1);
+  rowY.resize(static_cast<std::size_t>(size) + 1);
+  for (int k = 0; k <= size; ++k) {
+    columnX[k] = gridOrigin.x + static_cast<float>(k) * cellSize;
+    rowY[k] = gridOrigin.y + static_cast<float>(k) * cellSize;
+  }
+
+  const float panelPadding = std::round(16.0f * uiScale);
+  panel = {{std::round(viewport.position.x - panelPadding),
+            std::round(viewport.position.y - panelPadding)},
+           {std::round(viewport.size.x + panelPadding * 2),
+            std::round(viewport.size.y + panelPadding * 2)}};
+  panelScale = std::max(1.f, std::round(uiScale));
+}
+
+bool BoardLayout::zoomAt(sf::Vector2f point, float factor) {
+  if (!camera)
+    return false;
+  const float zoomed = std::clamp(cellSize * factor, minCellSize, maxCellSize);
+  if (zoomed == cellSize)
+    return false;
+
+  // Keep the grid point under the cursor where it is. The clue strips
+  // resize with the cells, so the viewport corner has to be placed first.
+  const sf::Vector2f gridPoint = (point - gridOrigin) / cellSize;
+  cellSize = zoomed;
+  place();
+  pan = viewport.position - (point - gridPoint * cellSize);
+  place();
+  return true;
+}
+
+bool BoardLayout::panBy(sf::Vector2f delta) {
+  if (!camera)
+    return false;
+  const sf::Vector2f before = pan;
+  pan -= delta;
+  place();
+  return pan != before;
+}
+
+bool BoardLayout::centerOn(sf::Vector2f cell) {
+  if (!camera)
+    return false;
+  const sf::Vector2f before = pan;
+  pan = cell * cellSize - viewport.size / 2.f;
+  place();
+  return pan != before;
+}
+
+unsigned BoardLayout::getClueFontSize() const {
+  return static_cast<unsigned>(std::min(28.f * uiScale, cellSize * 0.5f));
+}
+
+float BoardLayout::getClueMaxWidth(bool isRow) const {
+  return isRow ? slotHeight * 0.9f : (cellSize - 16.0f) * 0.9f;
+}
+
+std::optional<sf::Vector2i> BoardLayout::cellAt(sf::Vector2f point) const {
+  const sf::Vector2f end = viewport.position + viewport.size;
+  if (point.x < viewport.position.x || point.y < viewport.position.y ||
+      point.x >= end.x || point.y >= end.y)
+    return std::nullopt;
+  const int row = static_cast<int>((point.y - gridOrigin.y) / cellSize);
+  const int col = static_cast<int>((point.x - gridOrigin.x) / cellSize);
+  if (row >= size || col >= size)
+    return std::nullopt;
+  return sf::Vector2i{row, col};
+}
+
+CellRange BoardLayout::visibleCells() const {
+  const sf::Vector2f first = (viewport.position - gridOrigin) / cellSize;
+  const sf::Vector2f last =
+      (viewport.position + viewport.size - gridOrigin) / cellSize;
+  // Float error can push an exact edge either way; the viewport never
+  // extends past the grid, so clamping is enough.
+  const int firstRow = std::clamp(static_cast<int>(first.y), 0, size);
+  const int firstCol = std::clamp(static_cast<int>(first.x), 0, size);
+  const int lastRow =
+      std::clamp(static_cast<int>(std::ceil(last.y - 1e-3f)), firstRow, size);
+  const int lastCol =
+      std::clamp(static_cast<int>(std::ceil(last.x - 1e-3f)), firstCol, size);
+  return {firstRow, firstCol, lastRow - firstRow, lastCol - firstCol};
+}
+
+std::size_t BoardLayout::clueCount(bool isRow, int line) const {
+  if (line < 0 || line >= size)
+    return 0;
+  const int k = isRow ? line : size + line;
+  return lineClueStart[k + 1] - lineClueStart[k];
+}
+
+std::size_t BoardLayout::visibleSlots(bool isRow) const {
+  const std::size_t longest = isRow ? maxRowWidth : maxColHeight;
+  const float strip = isRow ? clueStrip.x : clueStrip.y;
+  if (!camera || strip >= static_cast<float>(longest) * slotHeight)
+    return longest;
+  return static_cast<std::size_t>(std::max(0.f, strip - clueGap) / slotHeight);
+}
+
+bool BoardLayout::isLineVisible(bool isRow, int line) const {
+  if (line < 0 || line >= size)
+    return false;
+  if (!camera)
+    return true;
+  const float middle =
+      (isRow ? rowY[line] : columnX[line]) + cellSize * 0.5f;
+  const float start = isRow ? viewport.position.y : viewport.position.x;
+  const float extent = isRow ? viewport.size.y : viewport.size.x;
+  return middle >= start && middle < start + extent;
+}
+
+bool BoardLayout::isClueVisible(bool isRow, int line, int index) const {
+  const std::size_t count = clueCount(isRow, line);
+  return index >= 0 && static_cast<std::size_t>(index) < count &&
+         isLineVisible(isRow, line) &&
+         count - 1 - static_cast<std::size_t>(index) < visibleSlots(isRow);
+}
+
+sf::Vector2f BoardLayout::clueCenter(bool isRow, int line, int index) const {
+  // Slots are filled from the clue edge outwards, last clue nearest
+  const auto slot =
+      static_cast<float>(clueCount(isRow, line) - 1 - static_cast<std::size_t>(index));
+  const float outward = slot * slotHeight + slotHeight / 2.0f + clueGap;
+  const sf::Vector2f edge = getClueEdge();
+  if (isRow)
+    return {edge.x - outward, rowY[line] + cellSize * 0.5f};
+  return {columnX[line] + cellSize * 0.5f, edge.y - outward};
+}
+
+std::optional<ClueSlot> BoardLayout::clueAt(sf::Vector2f point) const {
+  // Row clues sit left of the clue edge and column clues above it. Near the
+  // corner a partly scrolled line can reach past the edge, so both sides
+  // are tried there.
+  const sf::Vector2f edge = getClueEdge();
+  auto candidate = [&](bool isRow) -> std::optional<ClueSlot> {
+    const float across = isRow ? point.y - gridOrigin.y : point.x - gridOrigin.x;
+    const float outward = isRow ? edge.x - point.x : edge.y - point.y;
+    const int line = static_cast<int>(std::floor(across / cellSize));
+    if (!isLineVisible(isRow, line))
+      return std::nullopt;
+    const std::size_t count = clueCount(isRow, line);
+    const float slot =
+        std::round((outward - clueGap - slotHeight / 2.0f) / slotHeight);
+    if (slot < 0.f ||
+        slot >= static_cast<float>(std::min(count, visibleSlots(isRow))))
+      return std::nullopt;
+
+    const int index = static_cast<int>(count) - 1 - static_cast<int>(slot);
+    const sf::Vector2f offset = point - clueCenter(isRow, line, index);
+    const float radius = getClueHitRadius();
+    if (offset.x * offset.x + offset.y * offset.y > radius * radius)
+      return std::nullopt;
+    return ClueSlot{isRow, line, index};
+  };
+
+  std::optional<ClueSlot> hit;
+  if (point.x < edge.x)
+    hit = candidate(true);
+  if (!hit && point.y < edge.y)
+    hit = candidate(false);
+  return hit;
+}
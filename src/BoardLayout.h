@@ -0,0 +1,155 @@
+#ifndef OOP_BOARDLAYOUT_H
+#define OOP_BOARDLAYOUT_H
+
+#include "PicrossHints.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+struct ClueSlot {
+  bool isRow;
+  int line;
+  int index;
+};
+
+// Rows [firstRow, firstRow + rows) by columns [firstCol, firstCol + cols).
+struct CellRange {
+  int firstRow = 0;
+  int firstCol = 0;
+  int rows = 0;
+  int cols = 0;
+
+  [[nodiscard]] bool contains(int row, int col) const {
+    return row >= firstRow && row < firstRow + rows && col >= firstCol &&
+           col < firstCol + cols;
+  }
+  bool operator==(const CellRange &) const = default;
+};
+
+// Screen geometry of one puzzle in one window size: the cell size, where
+// every cell and every clue slot sits, the UI scale and the background
+// panel. It is computed by fit() whenever the puzzle or the window size
+// changes, and drawing, clicks and mode effects all read it from here.
+//
+// Boards larger than kCameraMinSize do not shrink to fit the window; they
+// are seen through a viewport that can be zoomed and panned, with the row
+// and column clues pinned to its left and top edges.
+class BoardLayout {
+  sf::Vector2u windowSize;
+  int size = 0;
+  float uiScale = 1.f;
+  float cellSize = 0.f;
+  float slotHeight = 0.f; // clue slot pitch along a line
+  float clueGap = 0.f;    // between the clue edge and the nearest slot
+  sf::Vector2f origin;     // top-left of the clue area
+  sf::Vector2f gridOrigin; // top-left of cell (0, 0)
+  sf::FloatRect viewport;  // visible part of the grid
+  sf::FloatRect panel;     // background nine-patch, pixel aligned
+  float panelScale = 1.f;
+  std::vector<float> columnX; // left edge of every column, then the right edge
+  std::vector<float> rowY;    // top edge of every row, then the bottom edge
+  // Clues of line k (rows first, then columns) are counted by
+  // lineClueStart[k + 1] - lineClueStart[k].
+  std::vector<std::uint32_t> lineClueStart;
+  std::size_t maxRowWidth = 0;
+  std::size_t maxColHeight = 0;
+
+  // Camera state, unused while the whole board fits
+  bool camera = false;
+  float minCellSize = 0.f;
+  float maxCellSize = 0.f;
+  sf::Vector2f pan;       // how far the grid is scrolled, in window pixels
+  sf::Vector2f clueStrip; // room for row clues (x) and column clues (y)
+  sf::FloatRect minimap;
+
+  // Recomputes everything that follows from the cell size and pan.
+  void place();
+
+public:
+  // Puzzles above this size are shown through the camera.
+  static constexpr int kCameraMinSize = 31;
+
+  // Sizes the board so grid and clues fill most of the window, centred, or
+  // for large boards starts the camera at a readable zoom, top-left corner.
+  void fit(const PicrossHints &hints, sf::Vector2u window);
+
+  [[nodiscard]] bool hasCamera() const { return camera; }
+
+  // Scales the cells by factor about a window point, within the zoom
+  // limits. Returns false if nothing moved.
+  bool zoomAt(sf::Vector2f point, float factor);
+
+  // Scrolls the grid by delta window pixels. Returns false if nothing
+  // moved.
+  bool panBy(sf::Vector2f delta);
+
+  // Scrolls so a grid point, in cells, is in the middle of the viewport
+  // where possible. Returns false if nothing moved.
+  bool centerOn(sf::Vector2f cell);
+
+  [[nodiscard]] sf::Vector2u getWindowSize() const { return windowSize; }
+  [[nodiscard]] int getSize() const { return size; }
+  [[nodiscard]] float getUiScale() const { return uiScale; }
+  [[nodiscard]] float getCellSize() const { return cellSize; }
+  [[nodiscard]] float getSlotHeight() const { return slotHeight; }
+  [[nodiscard]] sf::Vector2f getOrigin() const { return origin; }
+  [[nodiscard]] sf::Vector2f getGridOrigin() const { return gridOrigin; }
+  [[nodiscard]] float getGridExtent() const {
+    return static_cast<float>(size) * cellSize;
+  }
+  // Clues stack outwards from here, leftwards for rows and upwards for
+  // columns. Same as the grid origin until the camera scrolls.
+  [[nodiscard]] sf::Vector2f getClueEdge() const { return viewport.position; }
+  [[nodiscard]] sf::FloatRect getViewport() const { return viewport; }
+  [[nodiscard]] sf::FloatRect getPanel() const { return panel; }
+  [[nodiscard]] float getPanelScale() const { return panelScale; }
+
+  // Square for the board overview under a camera: the corner between the
+  // clue strips when it is roomy enough, else the bottom-right of the
+  // viewport. Empty without a camera.
+  [[nodiscard]] sf::FloatRect getMinimapArea() const { return minimap; }
+
+  // Character size the clue numbers are rasterised at.
+  [[nodiscard]] unsigned getClueFontSize() const;
+
+  // Widest a clue number may be drawn before it is scaled down.
+  [[nodiscard]] float getClueMaxWidth(bool isRow) const;
+
+  // Unchecked; row and col must be in [0, getSize()).
+  [[nodiscard]] sf::Vector2f cellPosition(int row, int col) const {
+    return {columnX[col], rowY[row]};
+  }
+
+  // Visible cell under a window point as {row, col}, if any.
+  [[nodiscard]] std::optional<sf::Vector2i> cellAt(sf::Vector2f point) const;
+
+  // Cells at least partly inside the viewport.
+  [[nodiscard]] CellRange visibleCells() const;
+
+  [[nodiscard]] std::size_t clueCount(bool isRow, int line) const;
+
+  // Slots per line that fit the clue strip, counted from the clue edge.
+  [[nodiscard]] std::size_t visibleSlots(bool isRow) const;
+
+  // A line's clues are shown while its middle is inside the viewport.
+  [[nodiscard]] bool isLineVisible(bool isRow, int line) const;
+
+  [[nodiscard]] bool isClueVisible(bool isRow, int line, int index) const;
+
+  // Unchecked; see clueCount().
+  [[nodiscard]] sf::Vector2f clueCenter(bool isRow, int line, int index) const;
+
+  // Clicks within this distance of a clue centre hit the clue.
+  [[nodiscard]] float getClueHitRadius() const { return cellSize * 0.4f; }
+
+  // The visible clue whose hit circle contains a window point, if any.
+  // Circles of one line just touch and never reach a neighbouring line, so
+  // the point's row band (or column band) and its distance from the clue
+  // edge pick the only candidate without scanning.
+  [[nodiscard]] std::optional<ClueSlot> clueAt(sf::Vector2f point) const;
+};
+
+#endif // OOP_BOARDLAYOUT_H
@@ -0,0 +1,109 @@
+#include "BoardMinimap.h"
+#include "Exceptions.h"
+#include "Grid.h"
+
+#include <algorithm>
+
+namespace {
+constexpr std::uint8_t kFilled[] = {74, 144, 226, 255};
+constexpr std::uint8_t kCrossed[] = {70, 70, 70, 255};
+constexpr std::uint8_t kEmpty[] = {210, 210, 210, 255};
+
+const std::uint8_t *cellColor(const Grid &grid, int row, int col) {
+  if (grid.is_filled(row, col))
+    return kFilled;
+  return grid.is_crossed(row, col) ? kCrossed : kEmpty;
+}
+} // namespace
+
+void BoardMinimap::downsample(std::size_t k, unsigned x, unsigned y) {
+  const Level &below = levels[k - 1];
+  Level &level = levels[k];
+  unsigned sum[4] = {};
+  unsigned count = 0;
+  for (unsigned dy = 0; dy < 2; ++dy) {
+    for (unsigned dx = 0; dx < 2; ++dx) {
+      const unsigned bx = 2 * x + dx;
+      const unsigned by = 2 * y + dy;
+      // Odd sizes leave the last texel of a row or column without a twin
+      if (bx >= below.size.x || by >= below.size.y)
+        continue;
+      const std::size_t i = (static_cast<std::size_t>(by) * below.size.x + bx) * 4;
+      for (int c = 0; c < 4; ++c)
+        sum[c] += below.pixels[i + c];
+      ++count;
+    }
+  }
+  const std::size_t i = (static_cast<std::size_t>(y) * level.size.x + x) * 4;
+  for (int c = 0; c < 4; ++c)
+    level.pixels[i + c] = static_cast<std::uint8_t>(sum[c] / count);
+}
+
+void BoardMinimap::rebuild(const Grid &grid) {
+  boardSize = grid.get_size();
+  levels.clear();
+  auto side = static_cast<unsigned>(boardSize);
+  while (true) {
+    Level &level = levels.emplace_back();
+    level.size = {side, side};
+    level.pixels.resize(static_cast<std::size_t>(side) * side * 4);
+    if (side <= 1)
+      break;
+    side = (side + 1) / 2;
+  }
+
+  Level &base = levels.front();
+  for (int row = 0; row < boardSize; ++row) {
+    for (int col = 0; col < boardSize; ++col) {
+      const std::uint8_t *color = cellColor(grid, row, col);
+      std::copy_n(color, 4,
+                  base.pixels.begin() +
+                      (static_cast<std::ptrdiff_t>(row) * boardSize + col) * 4);
+    }
+  }
+  for (std::size_t k = 1; k < levels.size(); ++k) {
+    for (unsigned y = 0; y < levels[k].size.y; ++y)
+      for (unsigned x = 0; x < levels[k].size.x; ++x)
+        downsample(k, x, y);
+  }
+
+  for (Level &level : levels) {
+    if (!level.texture.resize(level.size)) {
+      throw AssetLoadException("board minimap", "Texture");
+    }
+    level.texture.update(level.pixels.data());
+  }
+}
+
+void BoardMinimap::update(const Grid &grid, std::span<const int> cells) {
+  for (const int cell : cells) {
+    const int row = cell / boardSize;
+    const int col = cell % boardSize;
+    auto x = static_cast<unsigned>(col);
+    auto y = static_cast<unsigned>(row);
+
+    Level &base = levels.front();
+    const std::size_t i = (static_cast<std::size_t>(y) * base.size.x + x) * 4;
+    std::copy_n(cellColor(grid, row, col), 4, base.pixels.begin() +
+                                                  static_cast<std::ptrdiff_t>(i));
+    base.texture.update(&base.pixels[i], {1, 1}, {x, y});
+
+    for (std::size_t k = 1; k < levels.size(); ++k) {
+      x /= 2;
+      y /= 2;
+      downsample(k, x, y);
+      Level &level = levels[k];
+      const std::size_t j =
+          (static_cast<std::size_t>(y) * level.size.x + x) * 4;
+      level.texture.update(&level.pixels[j], {1, 1}, {x, y});
+    }
+  }
+}
+
+const sf::Texture &BoardMinimap::levelFor(float pixels) const {
+  for (std::size_t k = levels.size(); k-- > 1;) {
+    if (static_cast<float>(levels[k].size.x) >= pixels)
+      return levels[k].texture;
+  }
+  return levels.front().texture;
+}
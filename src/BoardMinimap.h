@@ -0,0 +1,44 @@
+#ifndef OOP_BOARDMINIMAP_H
+#define OOP_BOARDMINIMAP_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class Grid;
+
+// Overview of a whole board as a pyramid of small textures: level 0 has
+// one texel per cell, each level above averages 2x2 texels of the one
+// below. A changed cell touches one texel per level, and only those texels
+// are uploaded, so keeping the overview current costs O(log n) per move.
+class BoardMinimap {
+  struct Level {
+    sf::Vector2u size;
+    std::vector<std::uint8_t> pixels; // RGBA, row-major
+    sf::Texture texture;
+  };
+
+  std::vector<Level> levels;
+  int boardSize = 0;
+
+  // Recomputes texel (x, y) of level k > 0 from the level below.
+  void downsample(std::size_t k, unsigned x, unsigned y);
+
+public:
+  // Builds every level from the grid and uploads them whole. Throws
+  // AssetLoadException if a texture cannot be created.
+  void rebuild(const Grid &grid);
+
+  // Refreshes the cells listed as row * size + col.
+  void update(const Grid &grid, std::span<const int> cells);
+
+  [[nodiscard]] int getBoardSize() const { return boardSize; }
+
+  // The coarsest level still at least `pixels` texels wide (level 0 if the
+  // board is smaller), so drawing it that wide never drops more than every
+  // other texel.
+  [[nodiscard]] const sf::Texture &levelFor(float pixels) const;
+};
+
+#endif // OOP_BOARDMINIMAP_H
@@ -0,0 +1,273 @@
+#include "DifficultyRater.h"
+#include "BitKernels.h"
+#include "PuzzleSolver.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <mutex>
+
+namespace {
+constexpr std::array<double, kTechniqueCount> kWeights{1.0, 2.0, 4.0, 8.0,
+                                                       16.0};
+
+bool is_blank_line(std::span<const std::uint16_t> clues) {
+  return clues.empty() || (clues.size() == 1 && clues[0] == 0);
+}
+
+void set_range(std::vector<std::uint64_t> &mask, int from, int to) {
+  for (int c = from; c < to; ++c)
+    mask[c >> 6] |= std::uint64_t{1} << (c & 63);
+}
+
+// Given each block's leftmost and rightmost start, marks the cells covered
+// by both extremes of a block as filled and the cells no block can reach
+// as empty.
+void deduce_from_ranges(std::span<const std::uint16_t> blocks, int n,
+                        std::span<const int> first, std::span<const int> last,
+                        std::vector<std::uint64_t> &fill,
+                        std::vector<std::uint64_t> &blank) {
+  std::ranges::fill(fill, 0);
+  std::ranges::fill(blank, 0);
+  set_range(blank, 0, n);
+
+  std::vector<std::uint64_t> reach(fill.size(), 0);
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    const int len = blocks[i];
+    set_range(fill, last[i], first[i] + len);
+    set_range(reach, first[i], last[i] + len);
+  }
+  for (std::size_t w = 0; w < blank.size(); ++w)
+    blank[w] &= ~reach[w];
+}
+} // namespace
+
+Technique DifficultyReport::hardest() const {
+  for (std::size_t t = kTechniqueCount; t-- > 0;) {
+    if (cells[t] > 0)
+      return static_cast<Technique>(t);
+  }
+  return Technique::Overlap;
+}
+
+const char *DifficultyRater::technique_name(Technique technique) {
+  switch (technique) {
+  case Technique::Overlap:
+    return "Overlap";
+  case Technique::EdgeGap:
+    return "Edge/Gap";
+  case Technique::LineLogic:
+    return "Line logic";
+  case Technique::Probing:
+    return "Probing";
+  case Technique::Guessing:
+    return "Guessing";
+  }
+  return "Unknown";
+}
+
+void DifficultyRater::set_cell(int r, int c, bool isFilled) {
+  (isFilled ? filled : empty).set(r, c, true);
+  exhausted[r] = 0;
+  exhausted[filled.size() + c] = 0;
+  ++known;
+}
+
+int DifficultyRater::learn(bool isRow, int line,
+                           std::span<const std::uint64_t> fill,
+                           std::span<const std::uint64_t> blank) {
+  int gained = 0;
+  for (std::size_t w = 0; w < fill.size(); ++w) {
+    const BitLine cells = isRow ? filled.row(line) : filled.col(line);
+    const BitLine blanks = isRow ? empty.row(line) : empty.col(line);
+    const std::uint64_t decided = cells.words()[w] | blanks.words()[w];
+    for (int pass = 0; pass < 2; ++pass) {
+      std::uint64_t bits = (pass == 0 ? fill[w] : blank[w]) & ~decided;
+      while (bits) {
+        const int k = static_cast<int>(w) * 64 + std::countr_zero(bits);
+        bits &= bits - 1;
+        if (isRow)
+          set_cell(line, k, pass == 0);
+        else
+          set_cell(k, line, pass == 0);
+        ++gained;
+      }
+    }
+  }
+  return gained;
+}
+
+int DifficultyRater::sweep(const PicrossHints &hints, Technique technique) {
+  const int n = filled.size();
+  const int words = BitKernels::line_words(n);
+  fill_scratch.assign(words, 0);
+  blank_scratch.assign(words, 0);
+  std::vector<int> first;
+  std::vector<int> last;
+
+  const auto done =
+      static_cast<std::uint8_t>(1u << static_cast<int>(technique));
+
+  int gained = 0;
+  for (int id = 0; id < 2 * n; ++id) {
+    if (exhausted[id] & done)
+      continue;
+    const bool isRow = id < n;
+    const int line = isRow ? id : id - n;
+    const auto clues = isRow ? hints.get_row(line) : hints.get_col(line);
+    const BitLine cells = isRow ? filled.row(line) : filled.col(line);
+    const BitLine blanks = isRow ? empty.row(line) : empty.col(line);
+    if (cells.count() + blanks.count() == n)
+      continue;
+
+    if (is_blank_line(clues)) {
+      std::ranges::fill(fill_scratch, 0);
+      std::ranges::fill(blank_scratch, 0);
+      set_range(blank_scratch, 0, n);
+      gained += learn(isRow, line, fill_scratch, blank_scratch);
+      continue;
+    }
+
+    switch (technique) {
+    case Technique::Overlap: {
+      // Blocks packed to either end, ignoring every known cell
+      const int k = static_cast<int>(clues.size());
+      first.assign(k, 0);
+      last.assign(k, 0);
+      int left = 0;
+      for (int i = 0; i < k; ++i) {
+        first[i] = left;
+        left += clues[i] + 1;
+      }
+      int right = n;
+      for (int i = k - 1; i >= 0; --i) {
+        right -= clues[i];
+        last[i] = right;
+        right -= 1;
+      }
+      deduce_from_ranges(clues, n, first, last, fill_scratch, blank_scratch);
+      break;
+    }
+    case Technique::EdgeGap:
+      if (!solver.solve_general(clues, n, cells.words(), blanks.words()))
+        continue;
+      deduce_from_ranges(clues, n, solver.first_starts(),
+                         solver.last_starts(), fill_scratch, blank_scratch);
+      break;
+    default:
+      if (!solver.solve(clues, n, cells.words(), blanks.words()))
+        continue;
+      std::ranges::copy(solver.forced_filled(), fill_scratch.begin());
+      std::ranges::copy(solver.forced_empty(), blank_scratch.begin());
+      break;
+    }
+    const int learned = learn(isRow, line, fill_scratch, blank_scratch);
+    if (learned == 0)
+      exhausted[id] |= done;
+    gained += learned;
+  }
+  return gained;
+}
+
+int DifficultyRater::probe(const PicrossHints &hints) {
+  // Cells before the cursor were probed without a contradiction since the
+  // last one learned; they are only retried once the scan wraps around, and
+  // a full lap with nothing learned ends probing.
+  const int n = filled.size();
+  const int cells = n * n;
+  for (int step = 0; step < cells; ++step) {
+    const int r = probe_cursor / n;
+    const int c = probe_cursor % n;
+    probe_cursor = (probe_cursor + 1) % cells;
+    if (filled.test(r, c) || empty.test(r, c))
+      continue;
+    const int touched[] = {r, n + c};
+    for (int value = 0; value < 2; ++value) {
+      trial_filled = filled;
+      trial_empty = empty;
+      int trialKnown = known;
+      (value == 0 ? trial_filled : trial_empty).set(r, c, true);
+      if (!PuzzleSolver::propagate(hints, trial_filled, trial_empty,
+                                   trialKnown, touched, solver)) {
+        set_cell(r, c, value != 0);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+DifficultyReport DifficultyRater::rate(const PicrossHints &hints) {
+  const int n = hints.get_row_count();
+  filled = BitBoard(n);
+  empty = BitBoard(n);
+  known = 0;
+  exhausted.assign(2 * static_cast<std::size_t>(n), 0);
+  probe_cursor = 0;
+  DifficultyReport report;
+  const int cells = n * n;
+  if (cells == 0)
+    return report;
+
+  auto record = [&report](Technique t, int gained) {
+    ++report.sweeps;
+    if (gained > 0) {
+      report.cells[static_cast<std::size_t>(t)] += gained;
+      ++report.productive[static_cast<std::size_t>(t)];
+    }
+  };
+
+  record(Technique::Overlap, sweep(hints, Technique::Overlap));
+  Technique level = Technique::EdgeGap;
+  while (known < cells) {
+    const int gained = level == Technique::Probing ? probe(hints)
+                                                   : sweep(hints, level);
+    record(level, gained);
+    if (gained > 0)
+      level = Technique::EdgeGap;
+    else if (level == Technique::Probing)
+      break;
+    else
+      level = static_cast<Technique>(static_cast<int>(level) + 1);
+  }
+  report.cells[static_cast<std::size_t>(Technique::Guessing)] = cells - known;
+
+  double weighted = 0.0;
+  for (std::size_t t = 0; t < kTechniqueCount; ++t)
+    weighted += kWeights[t] * report.cells[t];
+  report.rating = weighted / cells + static_cast<double>(report.sweeps) / n;
+  return report;
+}
+
+std::vector<DifficultyReport>
+DifficultyRater::rate_all(std::span<const PicrossHints> puzzles,
+                          ThreadPool *pool) {
+  std::vector<DifficultyReport> reports(puzzles.size());
+  if (!pool) {
+    DifficultyRater rater;
+    for (std::size_t i = 0; i < puzzles.size(); ++i)
+      reports[i] = rater.rate(puzzles[i]);
+    return reports;
+  }
+
+  // One task per worker pulling puzzle indices, so each keeps its scratch
+  std::atomic<std::size_t> next{0};
+  std::mutex mutex;
+  std::condition_variable idle;
+  std::size_t pending = pool->size();
+  for (std::size_t t = 0; t < pool->size(); ++t) {
+    pool->submit([&] {
+      DifficultyRater rater;
+      for (std::size_t i = next++; i < puzzles.size(); i = next++)
+        reports[i] = rater.rate(puzzles[i]);
+      std::lock_guard lock(mutex);
+      if (--pending == 0)
+        idle.notify_all();
+    });
+  }
+  std::unique_lock lock(mutex);
+  idle.wait(lock, [&] { return pending == 0; });
+  return reports;
+}
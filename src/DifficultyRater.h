@@ -0,0 +1,83 @@
+#ifndef OOP_DIFFICULTYRATER_H
+#define OOP_DIFFICULTYRATER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitBoard.h"
+#include "LineSolver.h"
+#include "PicrossHints.h"
+
+class ThreadPool;
+
+// Deduction techniques from simplest to hardest. Guessing stands for cells
+// the other techniques could not decide.
+enum class Technique : std::uint8_t {
+  Overlap,   // block overlap from the clues alone
+  EdgeGap,   // overlap and unreachable cells given each block's extremes
+  LineLogic, // everything one line's clues and cells imply
+  Probing,   // assume a cell, propagate, keep the opposite on contradiction
+  Guessing
+};
+
+inline constexpr std::size_t kTechniqueCount = 5;
+
+struct DifficultyReport {
+  double rating = 0.0;
+  int sweeps = 0;                                // passes over the board
+  std::array<int, kTechniqueCount> cells{};      // cells decided per technique
+  std::array<int, kTechniqueCount> productive{}; // sweeps that made progress
+
+  [[nodiscard]] bool needs_guessing() const {
+    return cells[static_cast<std::size_t>(Technique::Guessing)] > 0;
+  }
+
+  [[nodiscard]] Technique hardest() const;
+};
+
+// Solves a puzzle the way a person would: each sweep applies the simplest
+// technique to every row and column, and a harder one is only tried after
+// a sweep with the current one decided nothing; any progress drops back to
+// the simplest. Overlap needs no cell state, so it runs once up front.
+//
+// The rating is the average technique weight per cell (1, 2, 4, 8 and 16
+// for guessed cells) plus the number of sweeps relative to the board width,
+// so long deduction chains count as well as hard steps. Line-logic puzzles
+// land roughly between 1.5 and 5.
+class DifficultyRater {
+  LineSolver solver;
+  BitBoard filled;
+  BitBoard empty;
+  int known = 0;
+  std::vector<std::uint64_t> fill_scratch;
+  std::vector<std::uint64_t> blank_scratch;
+  // Per line (rows, then columns), bit t is set once a sweep with technique
+  // t found nothing there; any new cell in the line clears it, so sweeps
+  // skip lines they cannot learn from.
+  std::vector<std::uint8_t> exhausted;
+  // Probing state: copied into rather than rebuilt for every trial, and the
+  // cell (row * n + col) the next probe() starts from.
+  BitBoard trial_filled;
+  BitBoard trial_empty;
+  int probe_cursor = 0;
+
+  int learn(bool isRow, int line, std::span<const std::uint64_t> fill,
+            std::span<const std::uint64_t> blank);
+  void set_cell(int r, int c, bool isFilled);
+  int sweep(const PicrossHints &hints, Technique technique);
+  int probe(const PicrossHints &hints);
+
+public:
+  DifficultyReport rate(const PicrossHints &hints);
+
+  // Rates a whole pack, spreading the puzzles over the pool's workers.
+  static std::vector<DifficultyReport>
+  rate_all(std::span<const PicrossHints> puzzles, ThreadPool *pool = nullptr);
+
+  static const char *technique_name(Technique technique);
+};
+
+#endif // OOP_DIFFICULTYRATER_H
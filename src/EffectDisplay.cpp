@@ -1,5 +1,5 @@
 #include "EffectDisplay.h"
-#include "Exceptions.h"
+#include "ResourceCache.h"
 #include <iostream>
 #include <cstdio>
 #include <cmath>
@@ -7,11 +7,10 @@
 EffectDisplay::EffectDisplay() = default;
 
 void EffectDisplay::loadAssets() {
-    if (!backgroundTexture.loadFromFile("assets/effect_background.png")) {
-        throw AssetLoadException("assets/effect_background.png", "Texture");
-    }
+    ResourceCache& cache = ResourceCache::shared();
+    backgroundTexture = cache.texture("assets/effect_background.png");
     
-    backgroundPatch = NinePatch(backgroundTexture, 6); 
+    backgroundPatch = NinePatch(*backgroundTexture, 6); 
     
     struct IconInfo { EffectType type; std::string filename; };
     std::vector<IconInfo> icons = {
@@ -30,18 +29,10 @@ void EffectDisplay::loadAssets() {
     };
     
     for (const auto& iconInfo : icons) {
-        sf::Texture tex;
-        std::string path = "assets/mob_effect/" + iconInfo.filename;
-        if (!tex.loadFromFile(path)) {
-            throw AssetLoadException(path, "Texture");
-        } else {
-            iconTextures[iconInfo.type] = tex;
-        }
+        iconTextures[iconInfo.type] = cache.texture("assets/mob_effect/" + iconInfo.filename);
     }
     
-    if (!font.openFromFile("assets/Monocraft.ttf")) {
-        throw AssetLoadException("assets/Monocraft.ttf", "Font");
-    }
+    font = cache.font("assets/Monocraft.ttf");
 }
 
 void EffectDisplay::draw(sf::RenderWindow& window, float uiScale, const std::vector<ActiveEffect>& activeEffects, std::optional<sf::Vector2f> startPos) {
@@ -98,10 +89,10 @@ void EffectDisplay::draw(sf::RenderWindow& window, float uiScale, const std::vec
         }
         
         auto fontSize = static_cast<unsigned int>(15.0f * uiScale); 
-        const_cast<sf::Texture&>(font.getTexture(fontSize)).setSmooth(false);
+        const_cast<sf::Texture&>(font->getTexture(fontSize)).setSmooth(false);
         
-        sf::Text nameText(font, nameStr, fontSize);
-        sf::Text durText(font, durationStr, fontSize);
+        sf::Text nameText(*font, nameStr, fontSize);
+        sf::Text durText(*font, durationStr, fontSize);
         
         float nameW = nameText.getLocalBounds().size.x;
         float durW = durText.getLocalBounds().size.x;
@@ -130,7 +121,7 @@ void EffectDisplay::draw(sf::RenderWindow& window, float uiScale, const std::vec
         window.draw(backgroundPatch);
         
         if (iconTextures.contains(effect.type)) {
-            const sf::Texture& texture = iconTextures.at(effect.type);
+            const sf::Texture& texture = *iconTextures.at(effect.type);
             sf::Sprite icon(texture);
             
             float iconSize = 30.0f;
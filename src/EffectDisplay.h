@@ -2,8 +2,9 @@
 #define EFFECT_DISPLAY_H
 
 #include <SFML/Graphics.hpp>
-#include <vector>
 #include <map>
+#include <memory>
+#include <vector>
 #include "NinePatch.h"
 
 enum class EffectType {
@@ -42,12 +43,12 @@ public:
     void draw(sf::RenderWindow& window, float uiScale, const std::vector<ActiveEffect>& activeEffects, std::optional<sf::Vector2f> startPos = std::nullopt);
 
 private:
-    sf::Texture backgroundTexture;
+    std::shared_ptr<const sf::Texture> backgroundTexture;
     NinePatch backgroundPatch;
     
-    std::map<EffectType, sf::Texture> iconTextures;
+    std::map<EffectType, std::shared_ptr<const sf::Texture>> iconTextures;
     
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font;
 };
 
 #endif // EFFECT_DISPLAY_H
@@ -1,5 +1,7 @@
 #include "EndermanMode.h"
-#include "Exceptions.h"
+#include "AssetLoader.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 #include <algorithm>
 #include <cmath>
@@ -9,6 +11,26 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+namespace {
+constexpr const char *kEndermanTexture = "assets/enemy/enderman.png";
+constexpr const char *kJumpscareSound = "assets/sound/Enderman_death.ogg";
+constexpr const char *kStareSound = "assets/sound/Enderman_stare.ogg";
+constexpr const char *kTeleportInSound = "assets/sound/Teleport1.ogg";
+constexpr const char *kTeleportOutSound = "assets/sound/Teleport2.ogg";
+
+std::string jumpscareFramePath(int i) {
+  return "assets/enemy/jumpscare/frame_" + std::string(i < 10 ? "0" : "") +
+         std::to_string(i) + ".png";
+}
+
+std::string idleSoundPath(int i) {
+  return "assets/sound/Enderman_idle" + std::to_string(i) + ".ogg";
+}
+std::string hurtSoundPath(int i) {
+  return "assets/sound/Enderman_hurt" + std::to_string(i) + ".ogg";
+}
+} // namespace
+
 // Hitbox definitions
 const std::array<EndermanMode::Hitbox, 9> EndermanMode::ENDERMAN_HITBOXES = {
   {
@@ -31,64 +53,64 @@ EndermanMode::EndermanMode(std::unique_ptr<GameMode> mode)
     jumpscareActive(false), playerLost(false), needsRescaling(false),
     hoverTimer(0.0f), endermanOpacity(0.0f), jumpscareTimer(0.0f),
     jumpscareFrame(0), jumpscareFrameTime(0.05f) {
-  if (!endermanTexture.loadFromFile("assets/enemy/enderman.png")) {
-    throw AssetLoadException("assets/enemy/enderman.png", "Texture");
-  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<> dis(10.0f, 20.0f);
+  spawnInterval = static_cast<float>(dis(gen));
 
-  if (!jumpscareTexture.loadFromFile("assets/enemy/jumpscare.png")) {
-    throw AssetLoadException("assets/enemy/jumpscare.png", "Texture");
+  // Portal particle frames
+  const TextureAtlas &atlas = TextureAtlas::game();
+  for (int i = 0; i <= 7; ++i) {
+      portalSystem.addFrame(atlas.region("particle/generic_" + std::to_string(i)));
   }
 
-  if (jumpscareSoundBuffer.loadFromFile("assets/sound/Enderman_death.ogg")) {
-    // Asset loaded
-  }
+}
+
+void EndermanMode::prefetch(AssetLoader &loader) {
+  loader.addTexture(kEndermanTexture);
+  for (const char *path : {kJumpscareSound, kStareSound, kTeleportInSound,
+                           kTeleportOutSound})
+    loader.addSoundBuffer(path);
+  for (int i = 1; i <= 5; ++i)
+    loader.addSoundBuffer(idleSoundPath(i));
+  for (int i = 1; i <= 4; ++i)
+    loader.addSoundBuffer(hurtSoundPath(i));
+}
+
+void EndermanMode::loadAssets() {
+  if (endermanTexture)
+    return;
+
+  ResourceCache &cache = ResourceCache::shared();
+  endermanTexture = cache.texture(kEndermanTexture);
+
+  std::vector<std::string> framePaths;
+  for (int i = 0; i < JUMPSCARE_TOTAL_FRAMES; ++i)
+    framePaths.push_back(jumpscareFramePath(i));
+  jumpscareFrames = std::make_unique<FrameStream>(std::move(framePaths));
 
-  if (stareSoundBuffer.loadFromFile("assets/sound/Enderman_stare.ogg")) {
-    stareSound.emplace(stareSoundBuffer);
+  jumpscareSoundBuffer = cache.optionalSoundBuffer(kJumpscareSound);
+
+  stareSoundBuffer = cache.optionalSoundBuffer(kStareSound);
+  if (stareSoundBuffer) {
+    stareSound.emplace(*stareSoundBuffer);
   }
 
   for (int i = 1; i <= 5; ++i) {
-    sf::SoundBuffer buffer;
-    std::string path =
-        "assets/sound/Enderman_idle" + std::to_string(i) + ".ogg";
-    if (buffer.loadFromFile(path)) {
-      idleBuffers.push_back(buffer);
+    if (auto buffer = cache.optionalSoundBuffer(idleSoundPath(i))) {
+      idleBuffers.push_back(std::move(buffer));
     }
   }
 
   for (int i = 1; i <= 4; ++i) {
-    sf::SoundBuffer buffer;
-    std::string path =
-        "assets/sound/Enderman_hurt" + std::to_string(i) + ".ogg";
-    if (buffer.loadFromFile(path)) {
-      hurtBuffers.push_back(buffer);
+    if (auto buffer = cache.optionalSoundBuffer(hurtSoundPath(i))) {
+      hurtBuffers.push_back(std::move(buffer));
     }
   }
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(10.0f, 20.0f);
-  spawnInterval = static_cast<float>(dis(gen));
-
-  // Load portal textures
-  portalTextures.reserve(8);
-  for (int i = 0; i <= 7; ++i) {
-      sf::Texture tex;
-      if (tex.loadFromFile("assets/particle/generic_" + std::to_string(i) + ".png")) {
-          portalTextures.push_back(std::move(tex));
-      }
-  }
-  for(const auto& t : portalTextures) {
-      portalSystem.addTexture(&t);
-  }
-
   // Load teleport sounds
-  if (!teleport1Buffer.loadFromFile("assets/sound/Teleport1.ogg")) {
-     throw AssetLoadException("assets/sound/Teleport1.ogg", "Sound");
-  }
-  if (!teleport2Buffer.loadFromFile("assets/sound/Teleport2.ogg")) {
-     throw AssetLoadException("assets/sound/Teleport2.ogg", "Sound");
-  }
+  teleport1Buffer = cache.soundBuffer(kTeleportInSound);
+  teleport2Buffer = cache.soundBuffer(kTeleportOutSound);
 }
 
 void EndermanMode::update(float deltaTime) {
@@ -210,19 +232,24 @@ void EndermanMode::updateJumpscareAnimation(float deltaTime) {
       playerLost = true;
       return;
     }
+  }
+  showJumpscareFrame();
+}
 
-    int col = jumpscareFrame % JUMPSCARE_COLS;
-    int row = jumpscareFrame / JUMPSCARE_COLS;
-
-    if (jumpscareSprite) {
-      jumpscareSprite->setTextureRect(sf::IntRect(
-        {col * JUMPSCARE_FRAME_WIDTH, row * JUMPSCARE_FRAME_HEIGHT},
-        {JUMPSCARE_FRAME_WIDTH, JUMPSCARE_FRAME_HEIGHT}));
-    }
+void EndermanMode::showJumpscareFrame() {
+  const sf::Texture *frame = jumpscareFrames->seek(jumpscareFrame);
+  if (!frame)
+    return;
+  if (jumpscareSprite) {
+    jumpscareSprite->setTexture(*frame, true);
+  } else {
+    jumpscareSprite.emplace(*frame);
   }
 }
 
 void EndermanMode::spawnEnderman() {
+  loadAssets();
+  jumpscareFrames->rewind();
   endermanVisible = true;
   endermanLifetime = 0.0f;
   currentFrame = 0;
@@ -239,7 +266,7 @@ void EndermanMode::spawnEnderman() {
   needsRescaling =
       true; // Defer position/scaling to draw() where we have window
 
-  endermanSprite.emplace(endermanTexture);
+  endermanSprite.emplace(*endermanTexture);
   endermanSprite->setTextureRect(
     sf::IntRect({0, 0}, {ENDERMAN_FRAME_WIDTH, ENDERMAN_FRAME_HEIGHT}));
 
@@ -265,14 +292,15 @@ void EndermanMode::triggerJumpscare() {
   if (stareSound)
     stareSound->stop();
 
-  jumpscareSprite.emplace(jumpscareTexture);
-  jumpscareSprite->setTextureRect(
-    sf::IntRect({0, 0}, {JUMPSCARE_FRAME_WIDTH, JUMPSCARE_FRAME_HEIGHT}));
-  jumpscareSprite->setPosition({0, 0});
+  // Frame 0 was decoded while the enderman stood there
+  jumpscareSprite.reset();
+  showJumpscareFrame();
 
-  jumpscareSound.emplace(jumpscareSoundBuffer);
-  jumpscareSound->setVolume(100.0f);
-  jumpscareSound->play();
+  if (jumpscareSoundBuffer) {
+    jumpscareSound.emplace(*jumpscareSoundBuffer);
+    jumpscareSound->setVolume(100.0f);
+    jumpscareSound->play();
+  }
 
   // Allow animation to finish before setting game over state via playerLost logic
 }
@@ -363,7 +391,7 @@ void EndermanMode::playRandomIdleSound() {
                                       static_cast<int>(idleBuffers.size()) - 1);
 
   int index = dis(gen);
-  idleSound.emplace(idleBuffers[index]);
+  idleSound.emplace(*idleBuffers[index]);
   idleSound->setVolume(80.0f);
   idleSound->play();
 }
@@ -378,7 +406,7 @@ void EndermanMode::playRandomHurtSound() {
                                       static_cast<int>(hurtBuffers.size()) - 1);
 
   int index = dis(gen);
-  hurtSound.emplace(hurtBuffers[index]);
+  hurtSound.emplace(*hurtBuffers[index]);
   hurtSound->setVolume(90.0f);
   hurtSound->play();
 }
@@ -468,9 +496,9 @@ void EndermanMode::draw(sf::RenderWindow &window) const {
 
 void EndermanMode::playTeleportSound(bool appear) {
     if (appear) {
-        teleportSound.emplace(teleport1Buffer);
+        teleportSound.emplace(*teleport1Buffer);
     } else {
-        teleportSound.emplace(teleport2Buffer);
+        teleportSound.emplace(*teleport2Buffer);
     }
     teleportSound->setVolume(100.0f);
     teleportSound->play();
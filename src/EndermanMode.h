@@ -1,14 +1,18 @@
 #ifndef OOP_ENDERMANMODE_H
 #define OOP_ENDERMANMODE_H
 
+#include "FrameStream.h"
 #include "GameMode.h"
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <memory>
 #include <optional>
 #include <vector>
 #include "ParticleTemplates.h"
 
+class AssetLoader;
+
 class EndermanMode : public GameModeDecorator {
 public:
     struct Hitbox {
@@ -23,6 +27,9 @@ public:
 
     explicit EndermanMode(std::unique_ptr<GameMode> mode);
 
+    // Queues the enderman sheet and sounds for prefetching.
+    static void prefetch(AssetLoader &loader);
+
     ~EndermanMode() override = default;
 
     void update(float deltaTime) override;
@@ -44,7 +51,6 @@ public:
     }
 
     // Portal Particles
-    std::vector<sf::Texture> portalTextures;
     TemplateParticleSystem<PortalParticleTrait> portalSystem;
 
     [[nodiscard]] int getMistakes() const override {
@@ -53,21 +59,23 @@ public:
     }
 
 private:
-    sf::Texture endermanTexture;
-    sf::Texture jumpscareTexture;
+    std::shared_ptr<const sf::Texture> endermanTexture;
+    // The jumpscare is 44 full-screen frames; they are streamed from disk
+    // while it plays instead of being kept as one texture.
+    std::unique_ptr<FrameStream> jumpscareFrames;
     std::optional<sf::Sprite> endermanSprite;
     std::optional<sf::Sprite> jumpscareSprite;
 
-    sf::SoundBuffer jumpscareSoundBuffer; // Will load Enderman_death.ogg
+    std::shared_ptr<const sf::SoundBuffer> jumpscareSoundBuffer; // Enderman_death.ogg, optional
     std::optional<sf::Sound> jumpscareSound;
 
-    sf::SoundBuffer stareSoundBuffer;
+    std::shared_ptr<const sf::SoundBuffer> stareSoundBuffer;
     std::optional<sf::Sound> stareSound;
 
-    std::vector<sf::SoundBuffer> idleBuffers;
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> idleBuffers;
     std::optional<sf::Sound> idleSound;
 
-    std::vector<sf::SoundBuffer> hurtBuffers;
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> hurtBuffers;
     std::optional<sf::Sound> hurtSound;
 
     float spawnTimer;
@@ -100,16 +108,19 @@ private:
 
     static const std::array<Hitbox, 9> ENDERMAN_HITBOXES;
 
-    static constexpr int JUMPSCARE_COLS = 5;
-    static constexpr int JUMPSCARE_ROWS = 9;
     static constexpr int JUMPSCARE_TOTAL_FRAMES = 44;
-    static constexpr int JUMPSCARE_FRAME_WIDTH = 800;
-    static constexpr int JUMPSCARE_FRAME_HEIGHT = 650;
 
     void updateEndermanAnimation(float deltaTime);
 
     void updateJumpscareAnimation(float deltaTime);
 
+    // Points the jumpscare sprite at jumpscareFrame once it is decoded.
+    void showJumpscareFrame();
+
+    // Sheet, jumpscare frames and sounds, set up when the first enderman
+    // appears.
+    void loadAssets();
+
     void spawnEnderman();
 
     void triggerJumpscare();
@@ -122,8 +133,8 @@ private:
 
     void updateStareSound(bool isHovering, float deltaTime);
 
-    sf::SoundBuffer teleport1Buffer;
-    sf::SoundBuffer teleport2Buffer;
+    std::shared_ptr<const sf::SoundBuffer> teleport1Buffer;
+    std::shared_ptr<const sf::SoundBuffer> teleport2Buffer;
     std::optional<sf::Sound> teleportSound;
 
     void playTeleportSound(bool appear);
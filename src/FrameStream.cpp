@@ -0,0 +1,86 @@
+#include "FrameStream.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+// Shared with the worker so a decode finishing after the stream is gone
+// has somewhere to go.
+struct FrameStream::Decoded {
+  std::mutex mutex;
+  std::uint64_t generation = 0; // bumped by rewind(); older decodes are stale
+  std::map<int, sf::Image> frames;
+};
+
+FrameStream::FrameStream(std::vector<std::string> framePaths, int lookahead)
+    : decoded(std::make_shared<Decoded>()), paths(std::move(framePaths)),
+      lookahead(std::max(lookahead, 1)) {}
+
+FrameStream::~FrameStream() = default;
+
+void FrameStream::rewind() {
+  {
+    std::lock_guard lock(decoded->mutex);
+    ++decoded->generation;
+    decoded->frames.clear();
+  }
+  requested = 0;
+  shown = -1;
+  requestUpTo(lookahead - 1);
+}
+
+void FrameStream::requestUpTo(int frame) {
+  frame = std::min(frame, getFrameCount() - 1);
+  std::uint64_t generation;
+  {
+    std::lock_guard lock(decoded->mutex);
+    generation = decoded->generation;
+  }
+  for (; requested <= frame; ++requested) {
+    worker.submit([shared = decoded, path = paths[static_cast<std::size_t>(requested)],
+                   index = requested, generation] {
+      sf::Image image;
+      if (!image.loadFromFile(path))
+        return; // a missing frame just holds the previous one
+      std::lock_guard lock(shared->mutex);
+      if (shared->generation == generation)
+        shared->frames.emplace(index, std::move(image));
+    });
+  }
+}
+
+const sf::Texture *FrameStream::seek(int frame) {
+  std::optional<sf::Image> newest;
+  int newestFrame = shown;
+  {
+    std::lock_guard lock(decoded->mutex);
+    auto &frames = decoded->frames;
+    const auto due = frames.upper_bound(frame);
+    if (due != frames.begin()) {
+      const auto last = std::prev(due);
+      newestFrame = last->first;
+      newest = std::move(last->second);
+      frames.erase(frames.begin(), due);
+    }
+  }
+
+  if (newest) {
+    const std::size_t next = 1 - current;
+    sf::Texture &texture = textures[next];
+    if (texture.getSize() == newest->getSize()) {
+      texture.update(*newest);
+      current = next;
+      shown = newestFrame;
+    } else if (texture.loadFromImage(*newest)) {
+      current = next;
+      shown = newestFrame;
+    }
+  }
+
+  // Keep the worker `lookahead` frames ahead of what is on screen
+  requestUpTo(std::max(frame, shown) + lookahead);
+  return shown < 0 ? nullptr : &textures[current];
+}
@@ -0,0 +1,53 @@
+#ifndef OOP_FRAMESTREAM_H
+#define OOP_FRAMESTREAM_H
+
+#include "ThreadPool.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Plays an animation stored as one image file per frame without keeping
+// it in memory. A worker decodes a few frames ahead of playback; seek()
+// uploads the newest one that is due into one of two textures, taking
+// turns so a frame is never overwritten while the previous draw may still
+// use it. Resident cost is those two textures plus `lookahead` decoded
+// images, whatever the length of the animation.
+class FrameStream {
+  struct Decoded;
+
+  ThreadPool worker{1};
+  std::shared_ptr<Decoded> decoded;
+  std::vector<std::string> paths;
+  int lookahead;
+  int requested = 0; // next frame to hand to the worker
+  int shown = -1;    // frame in textures[current], -1 for none yet
+  std::array<sf::Texture, 2> textures;
+  std::size_t current = 0;
+
+  void requestUpTo(int frame);
+
+public:
+  explicit FrameStream(std::vector<std::string> framePaths, int lookahead = 2);
+  ~FrameStream();
+
+  FrameStream(const FrameStream &) = delete;
+  FrameStream &operator=(const FrameStream &) = delete;
+
+  // Back to frame 0 and starts decoding it, so the first seek() of the
+  // next playback finds it ready. Frames still queued are dropped.
+  void rewind();
+
+  // The texture to draw for frame: the newest decoded frame not after it,
+  // or nullptr if none has arrived yet. Frames that are already late are
+  // skipped rather than shown.
+  const sf::Texture *seek(int frame);
+
+  [[nodiscard]] int getFrameCount() const {
+    return static_cast<int>(paths.size());
+  }
+};
+
+#endif // OOP_FRAMESTREAM_H
@@ -1,87 +1,64 @@
 #include "GameBackground.h"
+#include "AssetLoader.h"
+#include "ResourceCache.h"
 #include <random>
-#include "Exceptions.h"
 
+namespace {
+constexpr int kCaveSoundCount = 12;
 
-
-GameBackground::GameBackground() : currentType(BackgroundType::Desert), offset(0.0f), speed(30.0f), loaded(false), ambientTimer(10.0f) {
-  loadTextures();
-  loadSounds();
-}
-
-void GameBackground::loadTextures() {
-  if (!desertTexture.loadFromFile("assets/backgrounds/desert.jpg")) {
-    throw AssetLoadException("assets/backgrounds/desert.jpg", "Texture");
-  }
-  desertTexture.setRepeated(true);
-
-  if (!caveTexture.loadFromFile("assets/backgrounds/cave.jpg")) {
-    throw AssetLoadException("assets/backgrounds/cave.jpg", "Texture");
-  }
-  caveTexture.setRepeated(true);
-
-  if (!mineshaftTexture.loadFromFile("assets/backgrounds/mineshaft.jpg")) {
-    throw AssetLoadException("assets/backgrounds/mineshaft.jpg", "Texture");
-  }
-  mineshaftTexture.setRepeated(true);
-  
-  if (!classicTexture.loadFromFile("assets/classic1.jpg")) {
-      throw AssetLoadException("assets/classic1.jpg", "Texture");
+const char *texturePath(BackgroundType type) {
+  switch (type) {
+  case BackgroundType::Cave:
+    return "assets/backgrounds/cave.jpg";
+  case BackgroundType::Mineshaft:
+    return "assets/backgrounds/mineshaft.jpg";
+  case BackgroundType::Classic:
+    return "assets/classic1.jpg";
+  case BackgroundType::Desert:
+    break;
   }
-  classicTexture.setRepeated(true);
-  
-  loaded = true;
+  return "assets/backgrounds/desert.jpg";
 }
 
-void GameBackground::loadSounds() {
-  for (int i = 1; i <= 12; ++i) {
-    sf::SoundBuffer buffer;
-    std::string filename = "assets/sound/Cave" + std::to_string(i) + ".ogg";
-    if (buffer.loadFromFile(filename)) {
-      caveBuffers.push_back(buffer);
-    } else {
-        throw AssetLoadException(filename, "Sound");
-    }
-  }
+bool isUnderground(BackgroundType type) {
+  return type == BackgroundType::Cave || type == BackgroundType::Mineshaft;
 }
 
+std::string caveSoundPath(int i) {
+  return "assets/sound/Cave" + std::to_string(i) + ".ogg";
+}
+} // namespace
 
-void GameBackground::selectBackground(const GameConfig &config) {
-  BackgroundType selectedType;
+GameBackground::GameBackground() : currentType(BackgroundType::Desert), offset(0.0f), speed(30.0f), loaded(false), ambientTimer(10.0f) {}
 
+BackgroundType GameBackground::typeFor(const GameConfig &config) {
   if (config.betaStyle) {
-      selectedType = BackgroundType::Classic;
+      return BackgroundType::Classic;
   } else if (config.timeMode && config.spidersMode) {
-    selectedType = BackgroundType::Mineshaft;
+    return BackgroundType::Mineshaft;
   } else if (config.torchMode || config.spidersMode) {
-    selectedType = BackgroundType::Cave;
-  } else {
-    selectedType = BackgroundType::Desert; 
+    return BackgroundType::Cave;
   }
+  return BackgroundType::Desert;
+}
+
+void GameBackground::prefetch(AssetLoader &loader, const GameConfig &config) {
+  const BackgroundType type = typeFor(config);
+  loader.addTexture(texturePath(type), true);
+  if (isUnderground(type)) {
+    for (int i = 1; i <= kCaveSoundCount; ++i)
+      loader.addSoundBuffer(caveSoundPath(i));
+  }
+}
 
-  currentType = selectedType;
+void GameBackground::selectBackground(const GameConfig &config) {
+  currentType = typeFor(config);
   offset = 0.0f;
 
-  const sf::Texture* tex = nullptr;
-  switch (currentType) {
-  case BackgroundType::Desert:
-    tex = &desertTexture;
-    break;
-  case BackgroundType::Cave:
-    tex = &caveTexture;
-    break;
-  case BackgroundType::Mineshaft:
-    tex = &mineshaftTexture;
-    break;
-  case BackgroundType::Classic:
-    tex = &classicTexture;
-    break;
-  }
-  
-  if (tex) {
-      currentBackground1.emplace(*tex);
-      currentBackground2.emplace(*tex);
-  }
+  texture = ResourceCache::shared().texture(texturePath(currentType), true);
+  currentBackground1.emplace(*texture);
+  currentBackground2.emplace(*texture);
+  loaded = true;
 }
 
 void GameBackground::update(float deltaTime, sf::Vector2u windowSize, bool shouldScroll) {
@@ -112,28 +89,26 @@ void GameBackground::update(float deltaTime, sf::Vector2u windowSize, bool shoul
   }
 
   // Ambient sound update
-  if (currentType == BackgroundType::Cave ||
-      currentType == BackgroundType::Mineshaft) {
+  if (isUnderground(currentType)) {
     ambientTimer -= deltaTime;
     if (ambientTimer <= 0.0f) {
       // Play random cave sound
-      if (!caveBuffers.empty()) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(0,
-                                            static_cast<int>(caveBuffers.size()) -
-                                                1);
-
-        int idx = dis(gen);
-        ambientSound.emplace(caveBuffers[idx]);
+      static std::random_device rd;
+      static std::mt19937 gen(rd());
+      std::uniform_int_distribution<> dis(1, kCaveSoundCount);
+
+      int idx = dis(gen);
+      if (auto buffer = ResourceCache::shared().optionalSoundBuffer(caveSoundPath(idx))) {
+        // The sound playing now holds the old buffer; replace it first
+        ambientSound.reset();
+        ambientBuffer = std::move(buffer);
+        ambientSound.emplace(*ambientBuffer);
         ambientSound->setVolume(currentVolume);
         ambientSound->play();
         // std::cout << "Playing ambient sound index " << idx << std::endl;
       }
 
       // Result 1-3 mins (60-180s)
-      static std::random_device rd;
-      static std::mt19937 gen(rd());
       std::uniform_real_distribution<float> timeDis(60.0f, 180.0f);
       ambientTimer = timeDis(gen);
     }
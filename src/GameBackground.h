@@ -5,24 +5,28 @@
 #include "GameConfig.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <memory>
 #include <optional>
-#include <vector>
 
 enum class BackgroundType { Desert, Cave, Mineshaft, Classic };
 
+class AssetLoader;
+
 class GameBackground {
 public:
   GameBackground();
 
+  // Loads the backdrop for config; the others are never read.
   void selectBackground(const GameConfig &config);
+
+  // Queues the backdrop and, underground, the ambience config would use.
+  static void prefetch(AssetLoader &loader, const GameConfig &config);
+
   void update(float deltaTime, sf::Vector2u windowSize, bool shouldScroll = true);
   void draw(sf::RenderWindow &window) const;
 
 private:
-  sf::Texture desertTexture;
-  sf::Texture caveTexture;
-  sf::Texture mineshaftTexture;
-  sf::Texture classicTexture;
+  std::shared_ptr<const sf::Texture> texture; // selected backdrop only
 
   mutable std::optional<sf::Sprite> currentBackground1;
   mutable std::optional<sf::Sprite> currentBackground2;
@@ -32,13 +36,12 @@ private:
   float speed;
   bool loaded;
 
-  // Audio
-  std::vector<sf::SoundBuffer> caveBuffers;
+  // Audio; one cave sound is fetched each time the ambience plays
+  std::shared_ptr<const sf::SoundBuffer> ambientBuffer;
   std::optional<sf::Sound> ambientSound;
   float ambientTimer;
 
-  void loadTextures();
-  void loadSounds();
+  static BackgroundType typeFor(const GameConfig &config);
   
 public:
   void setVolume(float volume) {
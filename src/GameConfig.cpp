@@ -1,7 +1,9 @@
 #include "GameConfig.h"
 
-int GameConfig::calculateBonus() const {
-  int bonus = 0;
+#include <cmath>
+
+int GameConfig::calculateBonus(double difficultyRating) const {
+  int bonus = static_cast<int>(std::lround(difficultyRating * 1000.0));
   if (timeMode) bonus += 2000;
   if (torchMode) bonus += 2000;
   if (spidersMode) bonus += 2000;
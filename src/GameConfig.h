@@ -13,12 +13,17 @@ struct GameConfig {
   bool alchemyMode = false;
   bool backgroundMovement = true;
   bool betaStyle = false;
+  bool autoCross = false;    // cross the empty cells of finished lines
+  bool uniquePuzzles = true; // random boards must be solvable by logic alone
 
   float masterVolume = 1.0f;
   float musicVolume = 1.0f;
   float sfxVolume = 1.0f;
 
-  [[nodiscard]] int calculateBonus() const;
+  bool operator==(const GameConfig &) const = default;
+
+  // Modifier bonuses plus 1000 points per point of measured difficulty
+  [[nodiscard]] int calculateBonus(double difficultyRating = 0.0) const;
 };
 
 #endif // OOP_GAMECONFIG_H
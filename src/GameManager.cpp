@@ -1,13 +1,62 @@
 #include "GameManager.h"
+#include "AssetLoader.h"
 #include "Exceptions.h"
+#include "GameModeFactory.h"
+#include "LoadingScreen.h"
+#include "ResourceCache.h"
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iostream>
 #include <optional>
 #include <random>
 
+namespace {
+// Files the menus and end screens ask for while GameManager is being
+// built; anything left out is still loaded on first use. Game backgrounds
+// and mode assets are prefetched per configuration from the menu instead.
+struct StartupTexture {
+  const char *path;
+  bool repeated;
+};
+
+constexpr StartupTexture kStartupTextures[] = {
+    {"assets/cherry.jpg", true},
+    {"assets/beta.png", false},
+    {"assets/End_Poem_background.png", false},
+    {"assets/pictocraft.png", false},
+    {"assets/pictocraft-old.png", false},
+    {"assets/dirt.png", false},
+    {"assets/menu/menu_background.png", true},
+    {"assets/menu/tab_header_background.png", true},
+    {"assets/menu/header_separator.png", true},
+    {"assets/menu/footer_separator.png", true},
+    {"assets/buttons/button.png", false},
+    {"assets/buttons/button_disabled.png", false},
+    {"assets/buttons/slider_handle.png", false},
+    {"assets/buttons/slider_handle_highlighted.png", false},
+    {"assets/buttons/text_field.png", false},
+    {"assets/buttons/text_field_highlighted.png", false},
+};
+
+constexpr const char *kStartupSounds[] = {"assets/sound/click.mp3"};
+
+// Workers decoding in the background while the menu or a game runs
+constexpr unsigned kPrefetchThreads = 2;
+} // namespace
+
+struct GameManager::PendingBoard {
+  std::atomic<bool> done{false};
+  std::optional<PreparedBoard> board; // written by the worker before done
+  std::exception_ptr error;           // likewise, if reading it failed
+};
+
 GameManager::GameManager()
     : grid(), inMenu(true), inGameOver(false), inWinScreen(false),
-      deathSound(deathBuffer) {
+      deathBuffer(ResourceCache::shared().soundBuffer("assets/sound/hurt2.mp3")),
+      deathSound(*deathBuffer) {
 
   auto desktop = sf::VideoMode::getDesktopMode();
   unsigned int width = 1280;
@@ -24,10 +73,11 @@ GameManager::GameManager()
   }
   window.setFramerateLimit(60);
 
+  loadStartupAssets();
+
   menu = std::make_unique<GameMenu>();
   gameOverScreen = std::make_unique<GameOverScreen>();
   winScreen = std::make_unique<WinScreen>();
-  winScreen = std::make_unique<WinScreen>();
   
   try {
       pauseMenu = std::make_unique<PauseMenu>();
@@ -42,10 +92,6 @@ GameManager::GameManager()
   bool enableCustomCursor = true;
   customCursor = std::make_unique<CustomCursor>(window);
   customCursor->setEnabled(enableCustomCursor);
-  if (!deathBuffer.loadFromFile("assets/sound/hurt2.mp3")) {
-    throw AssetLoadException("assets/sound/hurt2.mp3", "Sound");
-  }
-
   background = std::make_unique<GameBackground>();
 
   if (!alphaMusic.openFromFile("assets/sound/Alpha.mp3")) {
@@ -122,23 +168,120 @@ void GameManager::updateMusic(float deltaTime) {
   }
 }
 
+void GameManager::loadStartupAssets() {
+  sf::Clock clock;
+  AssetLoader loader(ResourceCache::shared());
+  for (const auto &[path, repeated] : kStartupTextures)
+    loader.addTexture(path, repeated);
+  for (const char *path : kStartupSounds)
+    loader.addSoundBuffer(path);
+  loader.start();
+
+  LoadingScreen loadingScreen;
+  while (!loader.poll()) {
+    while (const std::optional<sf::Event> event = window.pollEvent()) {
+      if (event->is<sf::Event::Closed>())
+        window.close();
+    }
+    if (!window.isOpen())
+      break; // the loader's destructor waits for the decodes in flight
+    loadingScreen.draw(window, loader.getDone(), loader.getTotal());
+    window.display();
+  }
+
+  std::vector<AssetLoader::Timing> timings = loader.getTimings();
+  std::ranges::sort(timings, std::ranges::greater{},
+                    &AssetLoader::Timing::decodeSeconds);
+  std::cout << "Startup assets: " << loader.getDone() << "/"
+            << loader.getTotal() << " decoded in "
+            << clock.getElapsedTime().asMilliseconds() << " ms\n";
+  for (const auto &timing : timings) {
+    std::cout << "  " << static_cast<int>(timing.decodeSeconds * 1000.f)
+              << " ms  " << timing.path << "\n";
+  }
+}
+
+void GameManager::prefetchFor(const GameConfig &config) {
+  if (prefetchedConfig == config)
+    return;
+  prefetchedConfig = config;
+  if (!prefetcher) {
+    prefetcher = std::make_unique<AssetLoader>(ResourceCache::shared(),
+                                               kPrefetchThreads);
+  }
+  GameBackground::prefetch(*prefetcher, config);
+  GameModeFactory::prefetch(config, *prefetcher);
+  prefetcher->start();
+}
+
+void GameManager::returnToMenu() {
+  menu->reset();
+  inMenu = true;
+  if (customCursor) {
+    customCursor->setTorchMode(false);
+  }
+
+  // Let go of the finished game's mode, then of every asset nothing else
+  // holds. The menu prefetches again for whatever is selected.
+  hintAssistant.cancel();
+  grid.releaseMode();
+  ResourceCache::shared().trim();
+  prefetchedConfig.reset();
+}
+
 void GameManager::startGame() {
   if (!menu) {
     throw GameStateException("Menu is not initialized");
   }
-  GameConfig config = menu->getGameConfig();
+  // A mode or background decoding its files on first use while the
+  // prefetcher is still at them would read them twice, on the main thread,
+  // mid-game. Let the prefetcher finish while the board is prepared; run()
+  // shows the progress and calls finishStartGame() once both are done.
+  prefetchFor(menu->getGameConfig());
+  inMenu = false;
+  requestBoard(false);
+}
 
-  if (menu->getSourceMode() == SourceMode::File) {
-    grid.load_from_file(menu->getSelectedFile(), config);
-  } else {
-    grid.generate_random(menu->getGridSize(), config, 0.6);
-  }
+void GameManager::requestBoard(bool retry) {
+  auto pending = std::make_shared<PendingBoard>();
+  pendingBoard = pending;
+  startingGame = true;
+  restarting = retry;
+
+  const GameConfig config = menu->getGameConfig();
+  const bool fromFile = menu->getSourceMode() == SourceMode::File;
+  const std::string file = fromFile ? menu->getSelectedFile() : "";
+  const int size = menu->getGridSize();
+  const double rating = menu->getTargetRating();
+  boardWorker.submit([pending, config, fromFile, file, size, rating] {
+    try {
+      pending->board = fromFile
+                           ? Grid::read_board(file)
+                           : Grid::generate_board(size, config, 0.6, rating);
+    } catch (...) {
+      pending->error = std::current_exception();
+    }
+    pending->done = true;
+  });
+}
+
+void GameManager::finishStartGame() {
+  startingGame = false;
+  const std::shared_ptr<PendingBoard> pending = std::move(pendingBoard);
+  if (pending->error)
+    std::rethrow_exception(pending->error);
+
+  GameConfig config = menu->getGameConfig();
+  grid.apply_board(std::move(*pending->board), config);
+  if (const GameMode *mode = grid.getMode())
+    std::cout << "Started Grid with mode: " << *mode << " (difficulty "
+              << grid.get_difficulty().rating << ")\n";
 
   if (customCursor) {
     customCursor->setTorchMode(config.torchMode);
   }
 
-  if (background) {
+  if (background && !restarting) {
     background->selectBackground(config);
   }
 
@@ -149,33 +292,12 @@ void GameManager::startGame() {
 }
 
 void GameManager::resetGame() {
-  auto winSize = window.getSize();
-  int n = grid.get_size();
-
-  const auto &hints = grid.get_hints();
-  size_t maxRowWidth = hints.get_max_row_width();
-  size_t maxColHeight = hints.get_max_col_height();
-
-  float availableWidth = static_cast<float>(winSize.x) * 0.95f;
-  float availableHeight = static_cast<float>(winSize.y) * 0.95f;
-
-  float cellSizeByWidth =
-      availableWidth /
-      (static_cast<float>(n) + static_cast<float>(maxRowWidth) * 0.8f * 2.0f);
-  float cellSizeByHeight =
-      availableHeight /
-      (static_cast<float>(n) + static_cast<float>(maxColHeight) * 0.8f * 2.0f);
-  float cellSize = std::min(cellSizeByWidth, cellSizeByHeight);
-
-  float gridScreenSize = static_cast<float>(n) * cellSize;
-  float rowHintsWidth = static_cast<float>(maxRowWidth) * cellSize * 0.8f;
-  float colHintsHeight = static_cast<float>(maxColHeight) * cellSize * 0.8f;
-
-  float offsetX = (static_cast<float>(winSize.x) - gridScreenSize) / 2.f - rowHintsWidth;
-  float offsetY = (static_cast<float>(winSize.y) - gridScreenSize) / 2.f - colHintsHeight + 25.0f; // Consistent offset for all modes
-
-  renderer = std::make_unique<GridRenderer>(grid, cellSize,
-                                            sf::Vector2f(offsetX, offsetY));
+  hintAssistant.cancel();
+  if (renderer) {
+    renderer->bind(grid, window.getSize());
+  } else {
+    renderer = std::make_unique<GridRenderer>(grid, window.getSize());
+  }
   grid.setRenderer(renderer.get());
 }
 
@@ -190,6 +312,8 @@ void GameManager::run() {
         window.close();
         break;
       }
+      if (startingGame)
+        continue;
     // Inside loop
           if (auto key = event->getIf<sf::Event::KeyPressed>()) {
               if (isPaused) {
@@ -214,9 +338,7 @@ void GameManager::run() {
                sf::Mouse::setPosition(center, window);
            } else if (action == PauseAction::MainMenu) {
                isPaused = false;
-               menu->reset();
-               inMenu = true;
-               if (customCursor) customCursor->setTorchMode(false);
+               returnToMenu();
            }
            continue; // Skip other updates
       }
@@ -234,6 +356,8 @@ void GameManager::run() {
                           sf::State::Windowed);
           }
           window.setFramerateLimit(60);
+          if (renderer)
+            renderer->resize(window.getSize());
         }
 
         if (menu->shouldQuit()) {
@@ -247,37 +371,18 @@ void GameManager::run() {
       } else if (inGameOver) {
         GameOverAction action = gameOverScreen->handleEvent(*event, window);
         if (action == GameOverAction::Retry) {
-          GameConfig config = menu->getGameConfig();
-          if (menu->getSourceMode() == SourceMode::File) {
-            grid.load_from_file(menu->getSelectedFile(), config);
-          } else {
-            grid.generate_random(menu->getGridSize(), config,
-                                 0.6); // Assuming 0.6 is the default difficulty
-          }
-          if (customCursor) {
-            customCursor->setTorchMode(config.torchMode);
-          }
-          resetGame();
           inGameOver = false;
+          requestBoard(true);
         } else if (action == GameOverAction::MainMenu) {
-          menu->reset();
-          menu->reset();
-          inMenu = true;
           inGameOver = false;
-          if (customCursor) {
-            customCursor->setTorchMode(false);
-          }
+          returnToMenu();
         }
       } else if (inWinScreen) {
         if (auto key = event->getIf<sf::Event::KeyPressed>()) {
           if (key->code == sf::Keyboard::Key::Enter) {
             // Enter skips everything
-            menu->reset();
-            inMenu = true;
             inWinScreen = false;
-            if (customCursor) {
-              customCursor->setTorchMode(false);
-            }
+            returnToMenu();
           } else if (key->code == sf::Keyboard::Key::Space) {
             // Space speeds up scrolling
             winScreen->setSpeedMultiplier(3.0f);
@@ -289,11 +394,20 @@ void GameManager::run() {
           }
         }
       } else {
-        if (!grid.handleInput(*event, window)) {
+        const auto *key = event->getIf<sf::Event::KeyPressed>();
+        if (key && key->code == sf::Keyboard::Key::H) {
+          hintAssistant.request(grid);
+        } else if (key && key->code == sf::Keyboard::Key::F3) {
+          renderer->setShowDrawStats(!renderer->isShowingDrawStats());
+        } else if (renderer->handleCameraEvent(*event)) {
+          // Zoomed or panned the board
+        } else if (!grid.handleInput(*event, window)) {
           if (event->is<sf::Event::MouseButtonPressed>()) {
             auto m = event->getIf<sf::Event::MouseButtonPressed>();
             if (m && m->button == sf::Mouse::Button::Left) {
               renderer->handleClick(sf::Mouse::getPosition(window));
+            } else if (m && m->button == sf::Mouse::Button::Right) {
+              renderer->handleClick(sf::Mouse::getPosition(window), true);
             }
           }
         }
@@ -305,6 +419,28 @@ void GameManager::run() {
     }
 
     if (inMenu) {
+      prefetchFor(menu->getGameConfig());
+    }
+    if (prefetcher) {
+      prefetcher->poll();
+    }
+    if (startingGame && pendingBoard->done &&
+        (!prefetcher || prefetcher->isIdle())) {
+      finishStartGame();
+    }
+
+    if (startingGame) {
+      // The board counts as one more step after the prefetched files
+      std::size_t done = pendingBoard->done ? 1 : 0;
+      std::size_t total = 1;
+      if (prefetcher) {
+        done += prefetcher->getDone();
+        total += prefetcher->getTotal();
+      }
+      if (!startScreen)
+        startScreen = std::make_unique<LoadingScreen>("Preparing game");
+      startScreen->draw(window, done, total);
+    } else if (inMenu) {
       menu->update(deltaTime);
       menu->draw(window);
     } else if (inWinScreen) {
@@ -312,12 +448,8 @@ void GameManager::run() {
       winScreen->update(deltaTime);
       winScreen->draw(window);
       if (winScreen->isFinished()) {
-        menu->reset();
-        inMenu = true;
         inWinScreen = false;
-        if (customCursor) {
-          customCursor->setTorchMode(false);
-        }
+        returnToMenu();
       }
     } else {
       window.clear(sf::Color(240, 240, 240));
@@ -333,7 +465,7 @@ void GameManager::run() {
           
           int baseScore = grid.get_score();
           GameConfig cfg = menu->getGameConfig();
-          int bonus = cfg.calculateBonus();
+          int bonus = cfg.calculateBonus(grid.get_difficulty().rating);
           
           int finalScore = baseScore + bonus;
           
@@ -363,6 +495,7 @@ void GameManager::run() {
         }
         background->draw(window);
       }
+      renderer->setMoveHint(hintAssistant.poll(grid));
       renderer->draw(window);
       renderer->drawGameInfo(window);
 
@@ -7,11 +7,17 @@
 #include "GameOverScreen.h"
 #include "Grid.h"
 #include "GridRenderer.h"
+#include "HintAssistant.h"
 #include "PauseMenu.h"
+#include "ThreadPool.h"
 #include "WinScreen.h"
 #include "Leaderboard.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
+
+class AssetLoader;
+class LoadingScreen;
 
 class GameManager {
   sf::RenderWindow window;
@@ -27,7 +33,7 @@ class GameManager {
 
   std::unique_ptr<CustomCursor> customCursor;
 
-  sf::SoundBuffer deathBuffer;
+  std::shared_ptr<const sf::SoundBuffer> deathBuffer;
   sf::Sound deathSound;
 
   std::unique_ptr<GameBackground> background;
@@ -43,10 +49,29 @@ class GameManager {
   
   Leaderboard leaderboard;
 
+  // Next-move hints, searched on a worker thread (H key)
+  HintAssistant hintAssistant;
+
   // Pause Menu
   std::unique_ptr<PauseMenu> pauseMenu;
   bool isPaused;
 
+  // Decodes the background and mode assets of the configuration picked in
+  // the menu while the player is still choosing.
+  std::unique_ptr<AssetLoader> prefetcher;
+  std::optional<GameConfig> prefetchedConfig;
+
+  // The next board is read or generated and rated on boardWorker, which
+  // can take seconds for large boards with a target rating. startingGame
+  // is set from startGame() or Retry until that board and the prefetcher
+  // are both done; startScreen shows their progress meanwhile.
+  struct PendingBoard;
+  ThreadPool boardWorker{1};
+  std::shared_ptr<PendingBoard> pendingBoard;
+  bool startingGame = false;
+  bool restarting = false; // Retry: keep the background
+  std::unique_ptr<LoadingScreen> startScreen;
+
 public:
   GameManager();
   void run();
@@ -54,7 +79,15 @@ public:
   ~GameManager();
 
 private:
+  // Decodes the menu, screen and background assets on worker threads while
+  // a progress bar is shown, so the constructors below find them cached.
+  void loadStartupAssets();
+  void prefetchFor(const GameConfig &config);
+  // Back to the main menu, evicting assets only the last game used.
+  void returnToMenu();
   void startGame();
+  void requestBoard(bool retry);
+  void finishStartGame();
   void resetGame();
 };
 
@@ -1,6 +1,7 @@
 #include "GameMenu.h"
 #include "Exceptions.h"
 #include "MenuResolution.h"
+#include "ResourceCache.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -11,12 +12,14 @@ GameMenu::GameMenu()
       selectedSourceMode(SourceMode::File), selectedFile(), gridSize(5),
       availableResolutions(MenuResolution::getAvailableResolutions()),
       currentResolutionIndex(0), pendingResolutionChange(std::nullopt),
-      pendingFullscreen(false), initialFullscreenState(false), pendingBetaStyle(false), font(),
-      titleTexture(), buttonTexture(), buttonDisabledTexture(),
-      menuBackgroundTexture(), menuListBackgroundTexture(),
-      tabHeaderBackgroundTexture(), headerSeparatorTexture(),
-      footerSeparatorTexture(), panorama(), splashText(),
-      buttonManager(font, buttonTexture, buttonDisabledTexture), selectedTab(0),
+      pendingFullscreen(false), initialFullscreenState(false), pendingBetaStyle(false),
+      // The button manager keeps references, so these load up front
+      font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      buttonTexture(ResourceCache::shared().texture("assets/buttons/button.png")),
+      buttonDisabledTexture(
+          ResourceCache::shared().texture("assets/buttons/button_disabled.png")),
+      menuListBackgroundTexture(), panorama(), splashText(),
+      buttonManager(*font, *buttonTexture, *buttonDisabledTexture), selectedTab(0),
       titleSprite(std::nullopt), subtitleText(std::nullopt), availableFiles(),
       selectedFileIndex(0), difficultyOptions(), selectedDifficultyIndex(0) {
 
@@ -39,8 +42,10 @@ GameMenu::GameMenu()
 
   loadAssets();
 
-  difficultyOptions = {
-      {"Peaceful", 5}, {"Normal", 8}, {"Hard", 12}, {"Hardcore", 16}};
+  difficultyOptions = {{"Peaceful", 5, 1.6},
+                       {"Normal", 8, 2.0},
+                       {"Hard", 12, 2.4},
+                       {"Hardcore", 16, 2.8}};
 
   try {
     std::filesystem::path levelDir("nivele");
@@ -86,61 +91,25 @@ void GameMenu::reset() {
 }
 
 void GameMenu::loadAssets() {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-
-
-  if (!titleTexture.loadFromFile("assets/pictocraft.png")) {
-    throw AssetLoadException("assets/pictocraft.png", "Texture");
-  }
+  ResourceCache &cache = ResourceCache::shared();
 
-  titleSprite = sf::Sprite(titleTexture);
+  titleTexture = cache.texture("assets/pictocraft.png");
+  titleSprite = sf::Sprite(*titleTexture);
   auto bounds = titleSprite->getLocalBounds();
   titleSprite->setOrigin({bounds.size.x / 2.0f, bounds.size.y / 2.0f});
 
-  if (!buttonTexture.loadFromFile("assets/buttons/button.png")) {
-    throw AssetLoadException("assets/buttons/button.png", "Texture");
-  }
-  if (!buttonDisabledTexture.loadFromFile(
-          "assets/buttons/button_disabled.png")) {
-    throw AssetLoadException("assets/buttons/button_disabled.png", "Texture");
-  }
+  menuBackgroundTexture = cache.texture("assets/menu/menu_background.png", true);
+  tabHeaderBackgroundTexture =
+      cache.texture("assets/menu/tab_header_background.png", true);
+  headerSeparatorTexture = cache.texture("assets/menu/header_separator.png", true);
+  footerSeparatorTexture = cache.texture("assets/menu/footer_separator.png", true);
 
-  if (!menuBackgroundTexture.loadFromFile("assets/menu/menu_background.png")) {
-    throw AssetLoadException("assets/menu/menu_background.png", "Texture");
-  }
-  menuBackgroundTexture.setRepeated(true);
-
-  if (!tabHeaderBackgroundTexture.loadFromFile(
-          "assets/menu/tab_header_background.png")) {
-    throw AssetLoadException("assets/menu/tab_header_background.png",
-                             "Texture");
-  }
-  tabHeaderBackgroundTexture.setRepeated(true);
-
-  if (!headerSeparatorTexture.loadFromFile(
-          "assets/menu/header_separator.png")) {
-    throw AssetLoadException("assets/menu/header_separator.png", "Texture");
-  }
-  headerSeparatorTexture.setRepeated(true);
+  betaBackgroundTexture = cache.texture("assets/beta.png");
+  betaBackgroundSprite.emplace(*betaBackgroundTexture);
 
-  if (!footerSeparatorTexture.loadFromFile(
-          "assets/menu/footer_separator.png")) {
-    throw AssetLoadException("assets/menu/footer_separator.png", "Texture");
-  }
-  footerSeparatorTexture.setRepeated(true);
-
-  if (!betaBackgroundTexture.loadFromFile("assets/beta.png")) {
-     throw AssetLoadException("assets/beta.png", "Texture");
-  }
-  betaBackgroundSprite.emplace(betaBackgroundTexture);
-
-  if (!betaLogoTexture.loadFromFile("assets/pictocraft-old.png")) {
-      throw AssetLoadException("assets/pictocraft-old.png", "Texture");
-  }
+  betaLogoTexture = cache.texture("assets/pictocraft-old.png");
   
-  betaLogoSprite.emplace(betaLogoTexture);
+  betaLogoSprite.emplace(*betaLogoTexture);
   auto lb = betaLogoSprite->getLocalBounds();
   betaLogoSprite->setOrigin({lb.size.x / 2.0f, lb.size.y / 2.0f});
 }
@@ -192,6 +161,11 @@ void GameMenu::setupGameSetupScreen() {
       std::string filename = p.stem().string();
       labels.push_back("File: " + filename);
     }
+
+    labels.emplace_back(gameConfig.autoCross ? "Auto Cross: ON"
+                                             : "Auto Cross: OFF");
+    labels.emplace_back(gameConfig.uniquePuzzles ? "Unique Puzzles: ON"
+                                                 : "Unique Puzzles: OFF");
   } else {
     if (gameConfig.baseMode == GameModeType::Mistakes) {
       labels.emplace_back(gameConfig.timeMode ? "Time: ON" : "Time: OFF");
@@ -545,6 +519,12 @@ void GameMenu::handleGameSetupClick(int buttonIndex) {
         }
       }
       setupGameSetupScreen();
+    } else if (buttonIndex == 6) {
+      gameConfig.autoCross = !gameConfig.autoCross;
+      setupGameSetupScreen();
+    } else if (buttonIndex == 7) {
+      gameConfig.uniquePuzzles = !gameConfig.uniquePuzzles;
+      setupGameSetupScreen();
     }
   } else {
     if (buttonIndex == 2) {
@@ -641,7 +621,7 @@ void GameMenu::drawHighscores(sf::RenderWindow &window) {
   float currentY = 150.0f * scaleY;
   
   // Draw Title
-  sf::Text titleText(font, "=== HIGHSCORES ===");
+  sf::Text titleText(*font, "=== HIGHSCORES ===");
   titleText.setCharacterSize(static_cast<unsigned int>(40.0f * scale));
   titleText.setFillColor(sf::Color::Cyan);
   auto titleBounds = titleText.getLocalBounds();
@@ -653,7 +633,7 @@ void GameMenu::drawHighscores(sf::RenderWindow &window) {
   // Draw leaderboard entries
   const auto& entries = leaderboard.getEntries();
   if (entries.empty()) {
-    sf::Text noScoresText(font, "No scores yet!");
+    sf::Text noScoresText(*font, "No scores yet!");
     noScoresText.setCharacterSize(static_cast<unsigned int>(24.0f * scale));
     noScoresText.setFillColor(sf::Color::White);
     auto noScoresBounds = noScoresText.getLocalBounds();
@@ -662,7 +642,7 @@ void GameMenu::drawHighscores(sf::RenderWindow &window) {
   } else {
     for (const auto& entry : entries) {
       std::string line = entry.name + " ........ " + std::to_string(entry.score);
-      sf::Text entryText(font, line);
+      sf::Text entryText(*font, line);
       entryText.setCharacterSize(static_cast<unsigned int>(24.0f * scale));
       entryText.setFillColor(sf::Color::White);
       auto entryBounds = entryText.getLocalBounds();
@@ -686,8 +666,8 @@ void GameMenu::drawGameSetup(sf::RenderWindow &window) {
   bool isTimeModeAvailable = (gameConfig.baseMode == GameModeType::Mistakes);
   bool isAlchemyModeAvailable = (gameConfig.baseMode == GameModeType::Mistakes);
   buttonManager.layoutGameSetup(window, scale, scaleY, selectedTab,
-                                isTimeModeAvailable, isAlchemyModeAvailable, buttonTexture,
-                                buttonDisabledTexture);
+                                isTimeModeAvailable, isAlchemyModeAvailable, *buttonTexture,
+                                *buttonDisabledTexture);
   buttonManager.draw(window);
 }
 
@@ -714,13 +694,13 @@ void GameMenu::drawOverlay(sf::RenderWindow &window) const {
   }
   sf::RectangleShape headerSep(
       {static_cast<float>(window.getSize().x), separatorHeight});
-  headerSep.setTexture(&headerSeparatorTexture);
+  headerSep.setTexture(headerSeparatorTexture.get());
   headerSep.setPosition({0.f, headerHeight});
   window.draw(headerSep);
 
   sf::RectangleShape footerSep(
       {static_cast<float>(window.getSize().x), separatorHeight});
-  footerSep.setTexture(&footerSeparatorTexture);
+  footerSep.setTexture(footerSeparatorTexture.get());
   footerSep.setPosition({0.f, static_cast<float>(window.getSize().y) -
                                   footerHeight - separatorHeight});
   window.draw(footerSep);
@@ -757,7 +737,7 @@ void GameMenu::handleTextInput(const sf::Event& event) {
 void GameMenu::drawMenuBackground(sf::RenderWindow &window) {
     if (gameConfig.betaStyle && betaBackgroundSprite) {
         auto winSize = window.getSize();
-        auto texSize = betaBackgroundTexture.getSize();
+        auto texSize = betaBackgroundTexture->getSize();
         
         // Scale to fill screen
         float scaleX = static_cast<float>(winSize.x) / static_cast<float>(texSize.x);
@@ -2,6 +2,7 @@
 #define OOP_GAMEMENU_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -21,6 +22,7 @@ enum class SourceMode { File, Random };
 struct DifficultyOption {
   std::string name;
   int gridSize;
+  double targetRating; // DifficultyRater rating random boards aim for
 };
 
 class GameMenu {
@@ -39,6 +41,9 @@ public:
   SourceMode getSourceMode() const { return selectedSourceMode; }
   const std::string &getSelectedFile() const { return selectedFile; }
   int getGridSize() const { return gridSize; }
+  double getTargetRating() const {
+    return difficultyOptions[selectedDifficultyIndex].targetRating;
+  }
   void reset();
 
   // Resolution handling
@@ -89,22 +94,22 @@ private:
   bool initialFullscreenState;
   bool pendingBetaStyle;
 
-  // Assets
-  sf::Font font;
-  sf::Texture titleTexture;
-  sf::Texture buttonTexture;
-  sf::Texture buttonDisabledTexture;
+  // Assets, shared through ResourceCache
+  std::shared_ptr<const sf::Font> font;
+  std::shared_ptr<const sf::Texture> titleTexture;
+  std::shared_ptr<const sf::Texture> buttonTexture;
+  std::shared_ptr<const sf::Texture> buttonDisabledTexture;
 
   // New textures
-  sf::Texture menuBackgroundTexture;
+  std::shared_ptr<const sf::Texture> menuBackgroundTexture;
   sf::Texture menuListBackgroundTexture;
-  sf::Texture tabHeaderBackgroundTexture;
-  sf::Texture headerSeparatorTexture;
-  sf::Texture footerSeparatorTexture;
+  std::shared_ptr<const sf::Texture> tabHeaderBackgroundTexture;
+  std::shared_ptr<const sf::Texture> headerSeparatorTexture;
+  std::shared_ptr<const sf::Texture> footerSeparatorTexture;
 
   // Beta assets
-  sf::Texture betaBackgroundTexture;
-  sf::Texture betaLogoTexture;
+  std::shared_ptr<const sf::Texture> betaBackgroundTexture;
+  std::shared_ptr<const sf::Texture> betaLogoTexture;
 
   std::optional<sf::Sprite> betaBackgroundSprite;
   std::optional<sf::Sprite> betaLogoSprite;
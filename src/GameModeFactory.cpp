@@ -49,4 +49,22 @@ GameModeFactory::createGameMode(const GameConfig &config, int gridSize) {
   }
 
   return baseMode;
-}
\ No newline at end of file
+}
+
+void GameModeFactory::prefetch(const GameConfig &config, AssetLoader &loader) {
+  if (config.spidersMode) {
+    SpidersMode::prefetch(loader);
+  }
+
+  if (config.alchemyMode) {
+    AlchemyMode::prefetch(loader);
+  }
+
+  if (config.torchMode) {
+    TorchMode::prefetch(loader);
+  }
+
+  if (config.endermanMode) {
+    EndermanMode::prefetch(loader);
+  }
+}
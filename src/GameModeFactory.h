@@ -5,10 +5,16 @@
 #include "GameConfig.h"
 #include <memory>
 
+class AssetLoader;
+
 class GameModeFactory {
 public:
   static std::unique_ptr<GameMode> createGameMode(const GameConfig &config,
                                                   int gridSize);
+
+  // Queues the assets of every mode createGameMode() would stack for
+  // config, so they can be decoded before the game starts.
+  static void prefetch(const GameConfig &config, AssetLoader &loader);
 };
 
 #endif // GAMEMODEFACTORY_H
@@ -1,13 +1,9 @@
 #include "GameOverScreen.h"
-#include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
 
 GameOverScreen::GameOverScreen()
-    : font(), titleText(font), scoreLabel(font), scoreValue(font) {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-
+    : font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      titleText(*font), scoreLabel(*font), scoreValue(*font) {
   titleText.setString("You died!");
   titleText.setCharacterSize(60);
   titleText.setFillColor(sf::Color::White);
@@ -27,17 +23,12 @@ GameOverScreen::GameOverScreen()
 GameOverScreen::~GameOverScreen() = default;
 
 void GameOverScreen::createButtons() {
-  static sf::Texture buttonTexture;
-  if (buttonTexture.getSize().x == 0) {
-    if (!buttonTexture.loadFromFile("assets/buttons/button.png")) {
-      throw AssetLoadException("assets/buttons/button.png", "Texture");
-    }
-  }
+  buttonTexture = ResourceCache::shared().texture("assets/buttons/button.png");
 
   buttons.push_back(
-      std::make_unique<MenuButton>("Try again", font, buttonTexture, 20));
+      std::make_unique<MenuButton>("Try again", *font, *buttonTexture, 20));
   buttons.push_back(
-      std::make_unique<MenuButton>("Main Menu", font, buttonTexture, 20));
+      std::make_unique<MenuButton>("Main Menu", *font, *buttonTexture, 20));
 }
 
 void GameOverScreen::setScore(int score) {
@@ -83,6 +74,7 @@ void GameOverScreen::update(const sf::RenderWindow &window) {
 
   // Scale and Position Title
   titleText.setCharacterSize(static_cast<unsigned int>(60.0f * scale));
+  titleText.setShadowScale(scale);
   auto titleBounds = titleText.getLocalBounds();
   titleText.setPosition(
       {(static_cast<float>(winSize.x) - titleBounds.size.x) / 2.0f -
@@ -92,6 +84,8 @@ void GameOverScreen::update(const sf::RenderWindow &window) {
   // Scale and Position Score
   scoreLabel.setCharacterSize(static_cast<unsigned int>(30.0f * scale));
   scoreValue.setCharacterSize(static_cast<unsigned int>(30.0f * scale));
+  scoreLabel.setShadowScale(scale);
+  scoreValue.setShadowScale(scale);
 
   auto labelBounds = scoreLabel.getLocalBounds();
   auto valueBounds = scoreValue.getLocalBounds();
@@ -115,13 +109,11 @@ void GameOverScreen::update(const sf::RenderWindow &window) {
 }
 
 void GameOverScreen::draw(sf::RenderWindow &window) const {
-  auto [scale, scaleY] = calculateScale(window);
-
   window.draw(overlay);
 
-  ShadowedText::draw(window, titleText, scale);
-  ShadowedText::draw(window, scoreLabel, scale);
-  ShadowedText::draw(window, scoreValue, scale);
+  window.draw(titleText);
+  window.draw(scoreLabel);
+  window.draw(scoreValue);
 
   for (const auto &btn : buttons) {
     btn->draw(window);
@@ -2,6 +2,7 @@
 #define OOP_GAMEOVERSCREEN_H
 
 #include "MenuButton.h"
+#include "ShadowedText.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <vector>
@@ -9,10 +10,11 @@
 enum class GameOverAction { None, Retry, MainMenu };
 
 class GameOverScreen {
-  sf::Font font;
-  sf::Text titleText;
-  sf::Text scoreLabel;
-  sf::Text scoreValue;
+  std::shared_ptr<const sf::Font> font;
+  std::shared_ptr<const sf::Texture> buttonTexture;
+  ShadowedText titleText;
+  ShadowedText scoreLabel;
+  ShadowedText scoreValue;
   sf::RectangleShape overlay;
 
   std::vector<std::unique_ptr<MenuButton>> buttons;
@@ -0,0 +1,126 @@
+#include "GlyphStrip.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+// sf::Text draws each glyph one pixel larger than its bounds on every side
+// so anti-aliased edges are not clipped; the strip keeps that margin.
+constexpr int kGlyphPadding = 1;
+} // namespace
+
+void GlyphStrip::build(const sf::Font &font, unsigned size) {
+  characterSize = size;
+  for (int d = 0; d < 10; ++d)
+    glyphs[d] = font.getGlyph(U'0' + d, size, false);
+  for (int a = 0; a < 10; ++a)
+    for (int b = 0; b < 10; ++b)
+      kerning[a][b] = font.getKerning(U'0' + a, U'0' + b, size);
+
+  // Read the page only after every digit has been rasterised onto it
+  const sf::Image page = font.getTexture(size).copyToImage();
+  unsigned width = 0;
+  unsigned height = 1;
+  for (const sf::Glyph &glyph : glyphs) {
+    width += static_cast<unsigned>(glyph.textureRect.size.x + 2 * kGlyphPadding);
+    height = std::max(height, static_cast<unsigned>(glyph.textureRect.size.y +
+                                                    2 * kGlyphPadding));
+  }
+
+  sf::Image strip({std::max(width, 1u), height}, sf::Color::Transparent);
+  unsigned x = 0;
+  for (sf::Glyph &glyph : glyphs) {
+    const sf::IntRect source(
+        glyph.textureRect.position - sf::Vector2i{kGlyphPadding, kGlyphPadding},
+        glyph.textureRect.size + sf::Vector2i{2 * kGlyphPadding, 2 * kGlyphPadding});
+    if (glyph.textureRect.size.x > 0 && !strip.copy(page, {x, 0}, source)) {
+      throw AssetLoadException("digit glyphs", "Glyph Strip");
+    }
+    glyph.textureRect.position = {static_cast<int>(x) + kGlyphPadding,
+                                  kGlyphPadding};
+    x += static_cast<unsigned>(source.size.x);
+  }
+
+  if (!texture.loadFromImage(strip)) {
+    throw AssetLoadException("digit glyphs", "Glyph Strip");
+  }
+  texture.setSmooth(font.isSmooth());
+}
+
+int GlyphStrip::layout(unsigned value, std::array<int, 10> &digits,
+                       std::array<float, 10> &pen) const {
+  int count = 0;
+  do {
+    digits[count++] = static_cast<int>(value % 10);
+    value /= 10;
+  } while (value > 0);
+  std::reverse(digits.begin(), digits.begin() + count);
+
+  float x = 0.f;
+  for (int i = 0; i < count; ++i) {
+    if (i > 0)
+      x += kerning[digits[i - 1]][digits[i]];
+    pen[i] = x;
+    x += glyphs[digits[i]].advance;
+  }
+  return count;
+}
+
+sf::FloatRect GlyphStrip::measure(unsigned value) const {
+  std::array<int, 10> digits{};
+  std::array<float, 10> pen{};
+  const int count = layout(value, digits, pen);
+
+  // sf::Text puts the baseline one character size below the origin
+  const float baseline = static_cast<float>(characterSize);
+  float minX = std::numeric_limits<float>::max();
+  float minY = std::numeric_limits<float>::max();
+  float maxX = std::numeric_limits<float>::lowest();
+  float maxY = std::numeric_limits<float>::lowest();
+  for (int i = 0; i < count; ++i) {
+    const sf::FloatRect &bounds = glyphs[digits[i]].bounds;
+    minX = std::min(minX, pen[i] + bounds.position.x);
+    maxX = std::max(maxX, pen[i] + bounds.position.x + bounds.size.x);
+    minY = std::min(minY, baseline + bounds.position.y);
+    maxY = std::max(maxY, baseline + bounds.position.y + bounds.size.y);
+  }
+  return {{minX, minY}, {maxX - minX, maxY - minY}};
+}
+
+void GlyphStrip::append(sf::VertexArray &vertices, unsigned value,
+                        sf::Vector2f position, float scale,
+                        sf::Color color) const {
+  std::array<int, 10> digits{};
+  std::array<float, 10> pen{};
+  const int count = layout(value, digits, pen);
+
+  const float baseline = static_cast<float>(characterSize);
+  const auto pad = static_cast<float>(kGlyphPadding);
+  for (int i = 0; i < count; ++i) {
+    const sf::Glyph &glyph = glyphs[digits[i]];
+    const sf::Vector2f topLeft =
+        sf::Vector2f{pen[i], baseline} + glyph.bounds.position -
+        sf::Vector2f{pad, pad};
+    const sf::Vector2f bottomRight = sf::Vector2f{pen[i], baseline} +
+                                     glyph.bounds.position +
+                                     glyph.bounds.size + sf::Vector2f{pad, pad};
+    const sf::Vector2f t0 =
+        sf::Vector2f(glyph.textureRect.position) - sf::Vector2f{pad, pad};
+    const sf::Vector2f t1 = sf::Vector2f(glyph.textureRect.position) +
+                            sf::Vector2f(glyph.textureRect.size) +
+                            sf::Vector2f{pad, pad};
+
+    const sf::Vector2f p0 = position + topLeft * scale;
+    const sf::Vector2f p2 = position + bottomRight * scale;
+    const sf::Vertex quad[] = {
+        {p0, color, t0},
+        {{p2.x, p0.y}, color, {t1.x, t0.y}},
+        {p2, color, t1},
+        {p0, color, t0},
+        {p2, color, t1},
+        {{p0.x, p2.y}, color, {t0.x, t1.y}}};
+    for (const sf::Vertex &vertex : quad)
+      vertices.append(vertex);
+  }
+}
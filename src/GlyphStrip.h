@@ -0,0 +1,38 @@
+#ifndef OOP_GLYPHSTRIP_H
+#define OOP_GLYPHSTRIP_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+
+// The digits 0-9 of a font at one character size, copied out of the font's
+// glyph page into a small texture of their own. Numbers are then laid out
+// as plain quads, placed and measured exactly as sf::Text would, so many
+// of them can share one vertex array and one draw call.
+class GlyphStrip {
+  sf::Texture texture;
+  std::array<sf::Glyph, 10> glyphs{}; // textureRect in strip coordinates
+  std::array<std::array<float, 10>, 10> kerning{};
+  unsigned characterSize = 0;
+
+  // Digits of value and the pen position of each; returns the digit count.
+  int layout(unsigned value, std::array<int, 10> &digits,
+             std::array<float, 10> &pen) const;
+
+public:
+  // Throws AssetLoadException if the strip texture cannot be created.
+  void build(const sf::Font &font, unsigned size);
+
+  [[nodiscard]] unsigned getCharacterSize() const { return characterSize; }
+
+  [[nodiscard]] const sf::Texture &getTexture() const { return texture; }
+
+  // Same as sf::Text::getLocalBounds() for the number.
+  [[nodiscard]] sf::FloatRect measure(unsigned value) const;
+
+  // Appends two triangles per digit for the number drawn at position with
+  // a uniform scale.
+  void append(sf::VertexArray &vertices, unsigned value,
+              sf::Vector2f position, float scale, sf::Color color) const;
+};
+
+#endif // OOP_GLYPHSTRIP_H
@@ -1,9 +1,19 @@
 #include "Grid.h"
+#include "BitKernels.h"
+#include "DifficultyRater.h"
 #include "Exceptions.h"
 #include "GameModeFactory.h"
+#include "PuzzleGenerator.h"
+#include "PuzzleSolver.h"
+#include "ResourceCache.h"
 #include "ScoreMode.h"
+#include "ThreadPool.h"
 #include "TimeMode.h"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <ostream>
@@ -12,16 +22,42 @@
 #include <vector>
 
 int Grid::totalGridsCreated = 0;
+std::uint64_t Grid::lastRevision = 0;
+
+namespace {
+// Workers for speculative puzzle generation, started on first use and
+// shared by every grid.
+ThreadPool &generatorPool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+// Density search used by generate_random when a target rating is given
+constexpr int kRatingAttempts = 6;
+constexpr double kRatingTolerance = 0.2;
+constexpr double kDensityStep = 0.05;
+constexpr double kMinDensity = 0.3;
+constexpr double kMaxDensity = 0.8;
+
+// Whether the clues pin the board down. A board the rater finished without
+// guessing is unique already; the others get the full solver, which may
+// give up on large noisy boards.
+SolveStatus check_unique(const PicrossHints &hints,
+                         const DifficultyReport &report) {
+  if (!report.needs_guessing())
+    return SolveStatus::Unique;
+  return PuzzleSolver(hints).solve(&generatorPool()).status;
+}
+} // namespace
 
 Grid::Grid()
-    : size{}, blocks{}, total_correct_blocks{}, completed_blocks{},
-      correct_completed_blocks{}, hints{},
-      gameMode(std::make_unique<ScoreMode>()), hurtSound(hurtBuffer) {
+    : size{}, solution{}, filled{}, crossed{}, total_correct_blocks{}, completed_blocks{},
+      correct_completed_blocks{}, hints{}, lines{},
+      gameMode(std::make_unique<ScoreMode>()),
+      hurtBuffer(ResourceCache::shared().optionalSoundBuffer("assets/sound/hurt.mp3")) {
   totalGridsCreated++;
-  
-  // Load hurt sound
-  if (!hurtBuffer.loadFromFile("assets/sound/hurt.mp3")) {
-  }
+  if (hurtBuffer)
+    hurtSound.emplace(*hurtBuffer);
 }
 
 Grid::Grid(int grid_size, const std::vector<std::vector<bool>> &pattern,
@@ -29,7 +65,7 @@ Grid::Grid(int grid_size, const std::vector<std::vector<bool>> &pattern,
     : size{grid_size}, total_correct_blocks{0}, completed_blocks{0},
       correct_completed_blocks{0},
       gameMode(GameModeFactory::createGameMode(config, grid_size)),
-      hurtSound(hurtBuffer) {
+      autoCross(config.autoCross) {
   if (grid_size <= 0) {
     throw InvalidGridException("Grid size must be positive: " +
                                std::to_string(grid_size));
@@ -41,30 +77,31 @@ Grid::Grid(int grid_size, const std::vector<std::vector<bool>> &pattern,
   if (gameMode)
     std::cout << "Created Grid with mode: " << *gameMode << "\n";
 
-  std::vector<std::vector<bool>> bool_grid(size, std::vector<bool>(size));
-  blocks.resize(size);
-  for (int i = 0; i < size; i++) {
-    blocks[i].reserve(size);
-    for (int j = 0; j < size; j++) {
-      bool val = (i < static_cast<int>(pattern.size()) &&
-                  j < static_cast<int>(pattern[i].size()))
-                     ? pattern[i][j]
-                     : false;
-      if (val)
-        total_correct_blocks++;
-      blocks[i].emplace_back(val);
-      bool_grid[i][j] = val;
+  solution = BitBoard(size);
+  filled = BitBoard(size);
+  crossed = BitBoard(size);
+  revision = ++lastRevision;
+  changed_cells.clear();
+  for (int i = 0; i < size && i < static_cast<int>(pattern.size()); i++) {
+    for (int j = 0; j < size && j < static_cast<int>(pattern[i].size()); j++) {
+      solution.set(i, j, pattern[i][j]);
     }
   }
-  hints = PicrossHints(bool_grid);
+  total_correct_blocks = solution.count();
+  hints = PicrossHints(solution);
+  lines = LineTracker(hints, filled);
+  difficulty = DifficultyRater().rate(hints);
 }
 
 Grid::Grid(const Grid &other)
-    : size(other.size), blocks(other.blocks),
+    : size(other.size), solution(other.solution), filled(other.filled),
+      crossed(other.crossed),
       total_correct_blocks(other.total_correct_blocks),
       completed_blocks(other.completed_blocks),
       correct_completed_blocks(other.correct_completed_blocks),
-      hints(other.hints), hurtSound(hurtBuffer) {
+      hints(other.hints), lines(other.lines), difficulty(other.difficulty),
+      revision(other.revision), changed_cells(other.changed_cells),
+      autoCross(other.autoCross) {
   totalGridsCreated++;
 
   if (other.gameMode) {
@@ -79,12 +116,19 @@ Grid::Grid(const Grid &other)
 void swap(Grid &first, Grid &second) noexcept {
   using std::swap;
   swap(first.size, second.size);
-  swap(first.blocks, second.blocks);
+  swap(first.solution, second.solution);
+  swap(first.filled, second.filled);
+  swap(first.crossed, second.crossed);
   swap(first.total_correct_blocks, second.total_correct_blocks);
   swap(first.completed_blocks, second.completed_blocks);
   swap(first.correct_completed_blocks, second.correct_completed_blocks);
   swap(first.hints, second.hints);
+  swap(first.lines, second.lines);
+  swap(first.difficulty, second.difficulty);
+  swap(first.revision, second.revision);
+  swap(first.changed_cells, second.changed_cells);
   swap(first.gameMode, second.gameMode);
+  swap(first.autoCross, second.autoCross);
 
   if (first.gameMode)
     first.gameMode->setGrid(&first);
@@ -99,83 +143,167 @@ Grid &Grid::operator=(Grid other) {
 
 Grid::~Grid() = default;
 
-void Grid::load_from_file(const std::string &filename,
-                          const GameConfig &config) {
+PreparedBoard Grid::read_board(const std::string &filename) {
   std::ifstream file(filename);
   if (!file) {
     throw FileLoadException(filename);
   }
 
+  int size = 0;
   file >> size;
   if (size <= 0) {
     throw InvalidGridException("Invalid grid size in file: " +
                                std::to_string(size));
   }
-  blocks.clear();
-  blocks.resize(size);
-  total_correct_blocks = 0;
-  completed_blocks = 0;
-  correct_completed_blocks = 0;
 
-  std::vector<std::vector<bool>> bool_grid(size, std::vector<bool>(size));
+  const int words = BitKernels::line_words(size);
+  std::vector<std::uint64_t> rows(static_cast<size_t>(size) * words, 0);
   std::string line;
   for (int i = 0; i < size; i++) {
     file >> line;
-    blocks[i].clear();
-    for (int j = 0; j < size; j++) {
-      bool val = (j < static_cast<int>(line.size()) && line[j] == '1');
-      if (val)
-        total_correct_blocks++;
-      blocks[i].emplace_back(val);
-      bool_grid[i][j] = val;
+    for (int j = 0; j < size && j < static_cast<int>(line.size()); j++) {
+      if (line[j] == '1')
+        rows[static_cast<size_t>(i) * words + (j >> 6)] |= std::uint64_t{1}
+                                                           << (j & 63);
     }
   }
   file.close();
-  hints = PicrossHints(bool_grid);
 
-  gameMode = GameModeFactory::createGameMode(config, size);
-  if (gameMode)
-    gameMode->setGrid(this);
-  if (gameMode)
-    std::cout << "Loaded Grid with mode: " << *gameMode << "\n";
+  PreparedBoard board{BitBoard(size, rows), {}, {}};
+  board.hints = PicrossHints(board.solution);
+  board.difficulty = DifficultyRater().rate(board.hints);
+
+  switch (check_unique(board.hints, board.difficulty)) {
+  case SolveStatus::NoSolution:
+    throw InvalidGridException("Level has no solution: " + filename);
+  case SolveStatus::Multiple:
+    std::cerr << "Warning: " << filename << " has more than one solution\n";
+    break;
+  case SolveStatus::GaveUp:
+    std::cerr << "Info: Could not check " << filename
+              << " for a unique solution in time\n";
+    break;
+  case SolveStatus::Unique:
+    break;
+  }
+  return board;
 }
 
-// Generate random grid
-void Grid::generate_random(int grid_size, const GameConfig &config,
-                           double density) {
-  if (grid_size <= 0) {
+PreparedBoard Grid::generate_board(int size, const GameConfig &config,
+                                   double density, double targetRating) {
+  if (size <= 0) {
     throw InvalidGridException("Grid size must be positive: " +
-                               std::to_string(grid_size));
+                               std::to_string(size));
   }
-  size = grid_size;
-  blocks.clear();
-  blocks.resize(size);
-  total_correct_blocks = 0;
-  completed_blocks = 0;
-  correct_completed_blocks = 0;
 
-  std::vector<std::vector<bool>> bool_grid(size, std::vector<bool>(size));
   std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(0.0, 1.0);
-
-  for (int i = 0; i < size; i++) {
-    for (int j = 0; j < size; j++) {
-      bool val = dis(gen) < density;
-      if (val)
-        total_correct_blocks++;
-      blocks[i].emplace_back(val);
-      bool_grid[i][j] = val;
+  auto makeRows = [&](double cellDensity) {
+    std::vector<std::uint64_t> rows;
+    if (config.uniquePuzzles) {
+      const GeneratedPuzzle puzzle =
+          PuzzleGenerator(size, cellDensity)
+              .generate((static_cast<std::uint64_t>(rd()) << 32) | rd(),
+                        &generatorPool());
+      if (!puzzle.logic_solvable)
+        std::cout << "No logic-only board found, using an ambiguous one\n";
+      rows = puzzle.rows;
+    } else {
+      std::mt19937 gen(rd());
+      std::uniform_real_distribution<> dis(0.0, 1.0);
+
+      const int words = BitKernels::line_words(size);
+      rows.assign(static_cast<size_t>(size) * words, 0);
+      for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+          if (dis(gen) < cellDensity)
+            rows[static_cast<size_t>(i) * words + (j >> 6)] |=
+                std::uint64_t{1} << (j & 63);
+        }
+      }
+    }
+    return rows;
+  };
+
+  DifficultyRater rater;
+  std::vector<std::uint64_t> rows = makeRows(density);
+  DifficultyReport report = rater.rate(PicrossHints(rows, size));
+  if (targetRating > 0.0) {
+    // Sparser boards rate harder: walk the density towards the target and
+    // keep whichever board came closest.
+    double cellDensity = density;
+    for (int attempt = 1; attempt < kRatingAttempts &&
+                          std::abs(report.rating - targetRating) > kRatingTolerance;
+         ++attempt) {
+      cellDensity = std::clamp(
+          cellDensity + (report.rating > targetRating ? kDensityStep
+                                                      : -kDensityStep),
+          kMinDensity, kMaxDensity);
+      std::vector<std::uint64_t> candidate = makeRows(cellDensity);
+      const DifficultyReport candidateReport =
+          rater.rate(PicrossHints(candidate, size));
+      if (std::abs(candidateReport.rating - targetRating) <
+          std::abs(report.rating - targetRating)) {
+        rows = std::move(candidate);
+        report = candidateReport;
+      }
     }
   }
 
-  hints = PicrossHints(bool_grid);
+  PreparedBoard board{BitBoard(size, rows), {}, report};
+  board.hints = PicrossHints(board.solution);
+  // Plain noise is expected to be ambiguous, and from 50x50 up the solver
+  // mostly runs out of time on it; only a repaired board that still needs
+  // guessing is worth the check.
+  if (config.uniquePuzzles) {
+    switch (check_unique(board.hints, board.difficulty)) {
+    case SolveStatus::Multiple:
+      std::cout << "Generated board has more than one solution\n";
+      break;
+    case SolveStatus::GaveUp:
+      std::cout << "Could not check the generated board for a unique "
+                   "solution in time\n";
+      break;
+    default:
+      break;
+    }
+  }
+  return board;
+}
 
+void Grid::apply_board(PreparedBoard board, const GameConfig &config) {
+  size = board.solution.size();
+  completed_blocks = 0;
+  correct_completed_blocks = 0;
+  solution = std::move(board.solution);
+  filled = BitBoard(size);
+  crossed = BitBoard(size);
+  revision = ++lastRevision;
+  changed_cells.clear();
+  total_correct_blocks = solution.count();
+  hints = std::move(board.hints);
+  lines = LineTracker(hints, filled);
+  difficulty = board.difficulty;
+
+  autoCross = config.autoCross;
   gameMode = GameModeFactory::createGameMode(config, size);
   if (gameMode)
     gameMode->setGrid(this);
+}
+
+void Grid::load_from_file(const std::string &filename,
+                          const GameConfig &config) {
+  apply_board(read_board(filename), config);
+  if (gameMode)
+    std::cout << "Loaded Grid with mode: " << *gameMode << "\n";
+}
+
+void Grid::generate_random(int grid_size, const GameConfig &config,
+                           double density, double targetRating) {
+  apply_board(generate_board(grid_size, config, density, targetRating),
+              config);
   if (gameMode)
-    std::cout << "Generated Random Grid with mode: " << *gameMode << "\n";
+    std::cout << "Generated Random Grid with mode: " << *gameMode
+              << " (difficulty " << difficulty.rating << ")\n";
 }
 
 void Grid::toggle_block(int x, int y) {
@@ -185,12 +313,25 @@ void Grid::toggle_block(int x, int y) {
                                ")");
   }
 
-  bool was_completed = blocks[x][y].is_completed();
-  bool block_correct = blocks[x][y].is_correct();
+  // Crossed cells are protected until the player removes the cross
+  if (crossed.test(x, y))
+    return;
+
+  bool was_completed = filled.test(x, y);
+  bool block_correct = solution.test(x, y);
 
-  blocks[x][y].toggle();
+  bool now_completed = filled.flip(x, y);
+  revision = ++lastRevision;
+  changed_cells.push_back(x * size + y);
 
-  bool now_completed = blocks[x][y].is_completed();
+  // Only the toggled cell's row and column can change satisfaction
+  lines.update(true, x, filled.row(x), hints.get_row(x));
+  lines.update(false, y, filled.col(y), hints.get_col(y));
+
+  if (autoCross && now_completed) {
+    cross_finished_line(true, x);
+    cross_finished_line(false, y);
+  }
 
   if (!was_completed && now_completed) {
     completed_blocks++;
@@ -207,6 +348,49 @@ void Grid::toggle_block(int x, int y) {
   }
 }
 
+void Grid::cross_block(int x, int y) {
+  if (x < 0 || y < 0 || x >= size || y >= size) {
+    throw InvalidGridException("Coordinates out of bounds: (" +
+                               std::to_string(x) + ", " + std::to_string(y) +
+                               ")");
+  }
+  if (!filled.test(x, y)) {
+    crossed.flip(x, y);
+    revision = ++lastRevision;
+    changed_cells.push_back(x * size + y);
+  }
+}
+
+void Grid::cross_finished_line(bool isRow, int line) {
+  if (!lines.is_line_satisfied(isRow, line))
+    return;
+
+  // Every cell of the line that is neither filled nor crossed gets a cross.
+  const auto fill = isRow ? filled.row(line).words() : filled.col(line).words();
+  const auto cross =
+      isRow ? crossed.row(line).words() : crossed.col(line).words();
+  bool crossedAny = false;
+  for (size_t w = 0; w < fill.size(); ++w) {
+    const int base = static_cast<int>(w) * 64;
+    const int valid = std::min(64, size - base);
+    std::uint64_t open = ~(fill[w] | cross[w]);
+    if (valid < 64)
+      open &= (std::uint64_t{1} << valid) - 1;
+    while (open) {
+      const int k = base + std::countr_zero(open);
+      open &= open - 1;
+      if (isRow)
+        crossed.set(line, k, true);
+      else
+        crossed.set(k, line, true);
+      changed_cells.push_back(isRow ? line * size + k : k * size + line);
+      crossedAny = true;
+    }
+  }
+  if (crossedAny)
+    revision = ++lastRevision;
+}
+
 void Grid::update(float deltaTime) const {
   if (gameMode) {
     gameMode->update(deltaTime);
@@ -275,13 +459,13 @@ void Grid::drawMode(sf::RenderWindow &window) const {
 }
 
 int Grid::get_size() const { return size; }
-const Block &Grid::get_block(int x, int y) const {
+Block Grid::get_block(int x, int y) const {
   if (x < 0 || y < 0 || x >= size || y >= size) {
     throw OutOfBoundsException("Block coordinates out of bounds: (" +
                                std::to_string(x) + ", " + std::to_string(y) +
                                ")");
   }
-  return blocks[x][y];
+  return Block(solution.test(x, y), filled.test(x, y), crossed.test(x, y));
 }
 
 const PicrossHints &Grid::get_hints() const { return hints; }
@@ -308,39 +492,18 @@ Grid::WebDamageResult Grid::damageWeb(bool isRow, int line, int index) {
 }
 
 void Grid::healWebs() {
-  const auto &rowHints = hints.get_row_hints();
-  for (size_t i = 0; i < rowHints.size(); ++i) {
-    for (size_t j = 0; j < rowHints[i].size(); ++j) {
-      if (hints.isWebbed(true, static_cast<int>(i), static_cast<int>(j))) {
-        int health =
-            hints.getWebHealth(true, static_cast<int>(i), static_cast<int>(j));
-        if (health < 10) {
-          hints.setWebHealth(true, static_cast<int>(i), static_cast<int>(j),
-                             10); // Fully heal
-        }
-      }
-    }
-  }
-
-  const auto &colHints = hints.get_col_hints();
-  for (size_t j = 0; j < colHints.size(); ++j) {
-    for (size_t i = 0; i < colHints[j].size(); ++i) {
-      if (hints.isWebbed(false, static_cast<int>(j), static_cast<int>(i))) {
-        int health =
-            hints.getWebHealth(false, static_cast<int>(j), static_cast<int>(i));
-        if (health < 10) {
-          hints.setWebHealth(false, static_cast<int>(j), static_cast<int>(i),
-                             10);
-        }
-      }
-    }
-  }
+  hints.healWebs(10); // Fully heal
 }
 
 bool Grid::isHintWebbed(bool isRow, int line, int index) const {
   return hints.isWebbed(isRow, line, index);
 }
 
+void Grid::releaseMode() {
+  gameMode = std::make_unique<ScoreMode>();
+  gameMode->setGrid(this);
+}
+
 void Grid::setRenderer(const GridRenderer *r) const {
   if (gameMode)
     gameMode->setRenderer(r);
@@ -358,8 +521,8 @@ void Grid::damagePlayer(bool playSound) const {
     gameMode->setMistakes(current + 1);
     
     // Play hurt sound
-    if (playSound && hurtBuffer.getDuration() != sf::Time::Zero) {
-      hurtSound.play();
+    if (playSound && hurtSound) {
+      hurtSound->play();
     }
   }
 }
\ No newline at end of file
@@ -5,26 +5,52 @@
 #ifndef OOP_GRID_H
 #define OOP_GRID_H
 
+#include <cstdint>
 #include <iosfwd>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "BitBoard.h"
 #include "Block.h"
+#include "DifficultyRater.h"
 #include "GameMode.h"
 #include "GameConfig.h"
+#include "LineTracker.h"
 #include "PicrossHints.h"
 #include <memory>
 #include <SFML/Audio.hpp>
 
+// A board read from a file or generated, with its clues and rating. The
+// expensive part of starting a game, so it is built without touching any
+// Grid and can be built off the main thread; Grid::apply_board() then
+// installs it.
+struct PreparedBoard {
+  BitBoard solution;
+  PicrossHints hints;
+  DifficultyReport difficulty;
+};
+
 class Grid {
   int size;
-  std::vector<std::vector<Block>> blocks;
+  BitBoard solution; // cells that belong to the picture
+  BitBoard filled;   // cells the player has filled in
+  BitBoard crossed;  // cells the player has marked as empty
   int total_correct_blocks;
   int completed_blocks;
   int correct_completed_blocks;
   PicrossHints hints;
+  LineTracker lines;
+  DifficultyReport difficulty;
+  std::uint64_t revision = 0; // changes whenever the cells do
+  std::vector<int> changed_cells; // row * size + col, filled or crossed flipped
   std::unique_ptr<GameMode> gameMode;
+  bool autoCross = false;
   static int totalGridsCreated;
+  static std::uint64_t lastRevision;
+
+  void cross_finished_line(bool isRow, int line);
   
 public:
   enum class WebDamageResult { None, Damaged, Destroyed };
@@ -42,14 +68,40 @@ public:
 
   ~Grid();
 
+  // Reads and rates a level file; throws FileLoadException or
+  // InvalidGridException. Safe to call from any thread.
+  static PreparedBoard read_board(const std::string &filename);
+
+  // With config.uniquePuzzles the board is repaired until its clues pin it
+  // down by line logic alone; otherwise cells are plain noise at density.
+  // A positive targetRating moves the density, starting from the given
+  // one, until the measured difficulty comes close to it, which can take
+  // seconds on large boards. Safe to call from any thread.
+  static PreparedBoard generate_board(int grid_size,
+                                      const GameConfig &config = {},
+                                      double density = 0.5,
+                                      double targetRating = 0.0);
+
+  // Starts a game on the board: clears the player's marks and creates the
+  // configured mode. Main thread only.
+  void apply_board(PreparedBoard board, const GameConfig &config = {});
+
+  // read_board() or generate_board(), then apply_board(), on this thread.
   void load_from_file(const std::string &filename,
                       const GameConfig &config = {});
-
   void generate_random(int grid_size, const GameConfig &config = {},
-                       double density = 0.5);
+                       double density = 0.5, double targetRating = 0.0);
+
+  // Swaps the game mode for a plain ScoreMode so the old one, and the
+  // assets only it holds, can be released between games.
+  void releaseMode();
 
   void toggle_block(int x, int y);
 
+  // Marks/unmarks a non-filled cell as known-empty. Crosses are a player
+  // aid only: they never count as moves or mistakes for the game mode.
+  void cross_block(int x, int y);
+
   void update(float deltaTime) const;
 
   [[nodiscard]] bool handleInput(const sf::Event &event,
@@ -73,10 +125,50 @@ public:
 
   [[nodiscard]] int get_size() const;
 
-  [[nodiscard]] const Block &get_block(int x, int y) const;
+  [[nodiscard]] Block get_block(int x, int y) const;
+
+  // Unchecked packed access for per-cell loops; x is the row, y the column.
+  [[nodiscard]] bool is_filled(int x, int y) const { return filled.test(x, y); }
+
+  [[nodiscard]] bool is_crossed(int x, int y) const {
+    return crossed.test(x, y);
+  }
+
+  [[nodiscard]] bool is_correct(int x, int y) const {
+    return solution.test(x, y);
+  }
+
+  [[nodiscard]] const BitBoard &get_solution() const { return solution; }
+
+  [[nodiscard]] const BitBoard &get_filled() const { return filled; }
+
+  [[nodiscard]] const BitBoard &get_crossed() const { return crossed; }
 
   [[nodiscard]] const PicrossHints &get_hints() const;
 
+  // Per-line / per-clue satisfaction, kept up to date by toggle_block.
+  [[nodiscard]] const LineTracker &get_lines() const { return lines; }
+
+  [[nodiscard]] const DifficultyReport &get_difficulty() const {
+    return difficulty;
+  }
+
+  // Distinct for every board state a Grid has had, across all grids, so it
+  // can key caches of anything derived from the cells.
+  [[nodiscard]] std::uint64_t get_revision() const { return revision; }
+
+  void clear_dirty_lines() { lines.clear_dirty(); }
+
+  // Cells whose filled or crossed state flipped since the last
+  // clear_changed_cells(), as row * size + col, so renderers can patch just
+  // those. A new board empties the list; consumers notice it by its size or
+  // revision.
+  [[nodiscard]] std::span<const int> get_changed_cells() const {
+    return changed_cells;
+  }
+
+  void clear_changed_cells() { changed_cells.clear(); }
+
   void drawMode(sf::RenderWindow &window) const;
 
   void webHint(bool isRow, int line, int index);
@@ -94,7 +186,7 @@ public:
   
   void setSfxVolume(float volume) const {
       if (gameMode) gameMode->setSfxVolume(volume);
-      hurtSound.setVolume(volume);
+      if (hurtSound) hurtSound->setVolume(volume);
   }
 
   void damagePlayer(bool playSound = true) const;
@@ -103,8 +195,9 @@ public:
   [[nodiscard]] GameMode* getMode() const { return gameMode.get(); }
 
 private:
-  sf::SoundBuffer hurtBuffer;
-  mutable sf::Sound hurtSound;
+  // Only set on default-constructed grids; copies stay silent
+  std::shared_ptr<const sf::SoundBuffer> hurtBuffer;
+  mutable std::optional<sf::Sound> hurtSound;
 };
 
 #endif // OOP_GRID_H
\ No newline at end of file
@@ -1,93 +1,419 @@
 #include "GridRenderer.h"
 #include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
 
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 #include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cmath>
 #include <iostream>
 #include <random>
 #include <sstream>
 
-GridRenderer::GridRenderer(Grid &g, float size, sf::Vector2f off)
-    : grid(g), cellSize(size), offset(off), lastMistakes(0),
-      animationClock(), backgroundPatch(sf::Texture(), 4, 10),
-      hintTabPatch(sf::Texture(), 4, 0), isDiscoFeverMode(false),
-      defaultGlassColorIndex(0), colorTimer(0.0f), currentColorOffset(0) {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-  if (!webTexture.loadFromFile("assets/cobweb.png")) {
-    throw AssetLoadException("assets/cobweb.png", "Texture");
-  }
-
-  if (!backgroundTexture.loadFromFile("assets/grid/container.png")) {
-    throw AssetLoadException("assets/grid/container.png", "Texture");
-  }
-  backgroundPatch.setTexture(backgroundTexture);
-  backgroundPatch.setPatchScale(1.0f);
+namespace {
+// Adds an "X" covering the inner part of a cell as two thick diagonal quads.
+// Writes the two strokes of a cross over the cell at pos, twelve vertices
+// from `first`.
+void setCross(sf::VertexArray &vertices, std::size_t first, sf::Vector2f pos,
+              float size) {
+  const float inset = size * 0.25f;
+  const float half = std::max(1.0f, size * 0.06f);
+  const sf::Color color(60, 60, 60, 200);
+  const sf::Vector2f a = {pos.x + inset, pos.y + inset};
+  const sf::Vector2f b = {pos.x + size - inset, pos.y + size - inset};
+  const sf::Vector2f c = {pos.x + size - inset, pos.y + inset};
+  const sf::Vector2f d = {pos.x + inset, pos.y + size - inset};
+
+  auto stroke = [&](sf::Vector2f from, sf::Vector2f to) {
+    // Perpendicular offset of the stroke edges; diagonals are 45 degrees
+    const sf::Vector2f dir = to - from;
+    const sf::Vector2f normal =
+        sf::Vector2f{-dir.y, dir.x} * (half / dir.length());
+    const sf::Vector2f p0 = from + normal, p1 = from - normal;
+    const sf::Vector2f p2 = to - normal, p3 = to + normal;
+    for (sf::Vector2f p : {p0, p1, p2, p0, p2, p3})
+      vertices[first++] = sf::Vertex{p, color};
+  };
+  stroke(a, b);
+  stroke(c, d);
+}
 
-  if (!blockTexture.loadFromFile("assets/grid/slot.png")) {
-    throw AssetLoadException("assets/grid/slot.png", "Texture");
+// Writes the two triangles of an axis-aligned textured quad at vertex
+// `first`.
+void setQuad(sf::VertexArray &vertices, std::size_t first, sf::FloatRect area,
+             sf::FloatRect tex) {
+  const sf::Vector2f p0 = area.position;
+  const sf::Vector2f p2 = area.position + area.size;
+  const sf::Vector2f p1 = {p2.x, p0.y};
+  const sf::Vector2f p3 = {p0.x, p2.y};
+  const sf::Vector2f t0 = tex.position;
+  const sf::Vector2f t2 = tex.position + tex.size;
+  const sf::Vector2f t1 = {t2.x, t0.y};
+  const sf::Vector2f t3 = {t0.x, t2.y};
+  const sf::Vector2f corners[] = {p0, p1, p2, p0, p2, p3};
+  const sf::Vector2f coords[] = {t0, t1, t2, t0, t2, t3};
+  for (std::size_t k = 0; k < 6; ++k) {
+    vertices[first + k].position = corners[k];
+    vertices[first + k].texCoords = coords[k];
+    vertices[first + k].color = sf::Color::White;
   }
+}
 
+// A view that maps `area` onto itself but only draws inside it, so cells
+// cut by the camera viewport do not spill over the clue strips.
+sf::View clipView(sf::FloatRect area, sf::Vector2u targetSize) {
+  sf::View view(area);
+  const sf::Vector2f target(targetSize);
+  view.setViewport({{area.position.x / target.x, area.position.y / target.y},
+                    {area.size.x / target.x, area.size.y / target.y}});
+  return view;
+}
 
+// Default glass colour for a new puzzle. Light gray (7) and gray (4) are
+// hard to see, so they are only used by DiscoFeverMode.
+int randomGlassColor() {
+  static std::random_device rd;
+  static std::mt19937 gen(rd());
+  static const std::vector<int> validIndices = [] {
+    std::vector<int> indices;
+    for (int i = 0; i < 16; ++i) {
+      if (i != 7 && i != 4)
+        indices.push_back(i);
+    }
+    return indices;
+  }();
+  std::uniform_int_distribution<> dis(0, static_cast<int>(validIndices.size()) - 1);
+  return validIndices[dis(gen)];
+}
+} // namespace
+
+GridRenderer::GridRenderer(Grid &g, sf::Vector2u windowSize)
+    : grid(&g), font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      lastMistakes(0), animationClock(),
+      backgroundTexture(
+          ResourceCache::shared().texture("assets/grid/container.png")),
+      backgroundPatch(*backgroundTexture, 4, 10),
+      isDiscoFeverMode(false),
+      defaultGlassColorIndex(0), colorTimer(0.0f), currentColorOffset(0) {
+  backgroundPatch.setPatchScale(1.0f);
 
-  if (!hintTabTexture.loadFromFile("assets/grid/tab_hint.png")) {
-    throw AssetLoadException("assets/grid/tab_hint.png", "Texture");
-  }
-  hintTabPatch.setTexture(hintTabTexture);
-  hintTabPatch.setCornerSize(4);
-
-  // Load break textures
+  // Small sprites come from the shared atlas page
+  const TextureAtlas &atlas = TextureAtlas::game();
+  webRegion = atlas.region("cobweb");
+  slotRegion = atlas.region("grid/slot");
+  hintTabRegion = atlas.region("grid/tab_hint");
   for (int i = 0; i <= 9; ++i) {
-    sf::Texture tex;
-    std::string path =
-        "assets/break/destroy_stage_" + std::to_string(i) + ".png";
-    if (!tex.loadFromFile(path)) {
-      throw AssetLoadException(path, "Break Texture");
-    }
-    breakTextures.push_back(tex);
+    breakRegions.push_back(
+        atlas.region("break/destroy_stage_" + std::to_string(i)));
   }
 
-  // Load glass textures
   std::vector<std::string> glassColors = {
       "black",      "blue",       "brown", "cyan",    "gray",   "green",
       "light_blue", "light_gray", "lime",  "magenta", "orange", "pink",
       "purple",     "red",        "white", "yellow"};
-
   for (const auto &color : glassColors) {
-    sf::Texture tex;
-    std::string path = "assets/glass/" + color + "_stained_glass.png";
-    if (!tex.loadFromFile(path)) {
-      throw AssetLoadException(path, "Glass Texture");
+    glassRegions.push_back(atlas.region("glass/" + color + "_stained_glass"));
+    // The glass layer switches colour through texture coordinates only
+    if (glassRegions.back().page != glassRegions.front().page) {
+      throw AssetLoadException("glass/" + color, "Atlas page");
     }
-    glassTextures.push_back(tex);
   }
 
-  // Randomize default glass color
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::vector<int> validIndices;
-  for (int i = 0; i < 16; ++i) {
-    if (i != 7 && i != 4) // Exclude Light Gray (7) and Gray (4) as they are hard to see
-      validIndices.push_back(i);
-    // Note: These colors are still loaded and valid for DiscoFever mode 
-  }
-  std::uniform_int_distribution<> dis(0, static_cast<int>(validIndices.size()) - 1);
-  defaultGlassColorIndex = validIndices[dis(gen)];
-  
   // Load effect display assets
   try {
     effectDisplay.loadAssets();
   } catch (const std::exception& e) {
     std::cerr << "Error loading effect assets: " << e.what() << std::endl;
   }
+
+  bind(g, windowSize);
+}
+
+void GridRenderer::bind(Grid &g, sf::Vector2u windowSize) {
+  grid = &g;
+
+  // Per-puzzle state; the mode turns disco colours back on in setRenderer()
+  isDiscoFeverMode = false;
+  colorTimer = 0.0f;
+  currentColorOffset = 0;
+  glassLayerOffset = -1;
+  defaultGlassColorIndex = randomGlassColor();
+  moveHint.reset();
+  dragging = false;
+  minimapHeld = false;
+  minimapDirty = true;
+  lastMistakes = 0;
+  heartDisplay.reset();
+  minecraftHUD.reset();
+  animationClock.restart();
+
+  relayout(windowSize);
+}
+
+void GridRenderer::relayout(sf::Vector2u windowSize) const {
+  layout.fit(grid->get_hints(), windowSize);
+  layoutChanged();
+}
+
+void GridRenderer::layoutChanged() const {
+  hintsDirty = true;
+  layersDirty = true;
+  staticDirty = true;
+}
+
+bool GridRenderer::handleCameraEvent(const sf::Event &event) {
+  if (!layout.hasCamera())
+    return false;
+
+  if (const auto *wheel = event.getIf<sf::Event::MouseWheelScrolled>()) {
+    if (wheel->wheel != sf::Mouse::Wheel::Vertical)
+      return false;
+    if (layout.zoomAt(sf::Vector2f(wheel->position),
+                      std::pow(1.15f, wheel->delta)))
+      layoutChanged();
+    return true;
+  }
+  // Jumps the camera to the board point under the cursor on the minimap
+  auto jumpTo = [this](sf::Vector2i position) {
+    const sf::FloatRect area = layout.getMinimapArea();
+    const sf::Vector2f local = sf::Vector2f(position) - area.position;
+    const float cells = static_cast<float>(layout.getSize()) / area.size.x;
+    if (layout.centerOn(local * cells))
+      layoutChanged();
+  };
+
+  if (const auto *press = event.getIf<sf::Event::MouseButtonPressed>()) {
+    if (press->button == sf::Mouse::Button::Left &&
+        layout.getMinimapArea().contains(sf::Vector2f(press->position))) {
+      minimapHeld = true;
+      jumpTo(press->position);
+      return true;
+    }
+    if (press->button != sf::Mouse::Button::Middle)
+      return false;
+    dragging = true;
+    dragFrom = press->position;
+    return true;
+  }
+  if (const auto *release = event.getIf<sf::Event::MouseButtonReleased>()) {
+    if (release->button == sf::Mouse::Button::Left && minimapHeld) {
+      minimapHeld = false;
+      return true;
+    }
+    if (release->button != sf::Mouse::Button::Middle || !dragging)
+      return false;
+    dragging = false;
+    return true;
+  }
+  if (const auto *moved = event.getIf<sf::Event::MouseMoved>()) {
+    if (minimapHeld) {
+      jumpTo(moved->position);
+      return true;
+    }
+    if (!dragging)
+      return false;
+    if (layout.panBy(sf::Vector2f(moved->position - dragFrom)))
+      layoutChanged();
+    dragFrom = moved->position;
+    return true;
+  }
+  return false;
+}
+
+void GridRenderer::drawMinimap(sf::RenderTarget &target) const {
+  const sf::FloatRect area = layout.getMinimapArea();
+  const float frame = std::max(2.0f, 3.0f * layout.getUiScale());
+
+  sf::RectangleShape backdrop(area.size);
+  backdrop.setPosition(area.position);
+  backdrop.setFillColor(sf::Color(0, 0, 0, 170));
+  backdrop.setOutlineThickness(frame);
+  backdrop.setOutlineColor(sf::Color(0, 0, 0, 170));
+  drawCounted(target, backdrop);
+
+  const sf::Texture &level = minimap.levelFor(area.size.x);
+  sf::Sprite board(level);
+  board.setPosition(area.position);
+  board.setScale({area.size.x / static_cast<float>(level.getSize().x),
+                  area.size.y / static_cast<float>(level.getSize().y)});
+  drawCounted(target, board);
+
+  // Where the viewport sits on the whole board
+  const sf::FloatRect viewport = layout.getViewport();
+  const float toMap = area.size.x / layout.getGridExtent();
+  sf::RectangleShape view(viewport.size * toMap);
+  view.setPosition(area.position +
+                   (viewport.position - layout.getGridOrigin()) * toMap);
+  view.setFillColor(sf::Color::Transparent);
+  view.setOutlineThickness(-std::max(1.0f, layout.getUiScale()));
+  view.setOutlineColor(sf::Color(255, 230, 90));
+  drawCounted(target, view);
 }
 
 void GridRenderer::setDiscoFeverMode(bool enabled) {
   isDiscoFeverMode = enabled;
+  layersDirty = true;
+}
+
+sf::Color GridRenderer::clueColor(bool isRow, int line, int index) const {
+  // Clues already matched by the player's cells are dimmed
+  return grid->get_lines().is_clue_satisfied(isRow, line, index)
+             ? sf::Color(150, 150, 150)
+             : sf::Color::White;
+}
+
+void GridRenderer::rebuildHintText() const {
+  const auto &hints = grid->get_hints();
+  const float uiScale = layout.getUiScale();
+  const unsigned fontSize = layout.getClueFontSize();
+  if (hintGlyphs.getCharacterSize() != fontSize)
+    hintGlyphs.build(*font, fontSize);
+
+  hintText.clear();
+  clueText.clear();
+  webMarkers.clear();
+  lineClueStart.assign(1, 0);
+
+  const sf::Vector2f shadowOffset(std::round(2.0f * uiScale),
+                                  std::round(2.0f * uiScale));
+
+  // Centres a clue on its slot, shrunk if it is too wide, and emits its
+  // shadow and text; webbed clues only record where the web goes.
+  auto placeClue = [&](bool isRow, int line, int index, float webDrop) {
+    if (!layout.isClueVisible(isRow, line, index)) {
+      clueText.push_back({hintText.getVertexCount(), 0});
+      return;
+    }
+    const sf::Vector2f center = layout.clueCenter(isRow, line, index);
+    const float maxWidth = layout.getClueMaxWidth(isRow);
+    const unsigned value = isRow ? hints.get_row(line)[index]
+                                 : hints.get_col(line)[index];
+    sf::FloatRect bounds = hintGlyphs.measure(value);
+    float scale = 1.f;
+    if (bounds.size.x > maxWidth) {
+      scale = maxWidth / bounds.size.x;
+      bounds = {bounds.position * scale, bounds.size * scale};
+    }
+    const sf::Vector2f pos = {
+        std::round(center.x - bounds.size.x / 2.0f - bounds.position.x),
+        std::round(center.y - bounds.size.y / 2.0f - bounds.position.y)};
+
+    if (grid->isHintWebbed(isRow, line, index)) {
+      const sf::Vector2f webCenter =
+          pos + bounds.size / 2.f + sf::Vector2f{0.f, webDrop};
+      webMarkers.push_back({isRow, line, index, webCenter});
+      clueText.push_back({hintText.getVertexCount(), 0});
+      return;
+    }
+    hintGlyphs.append(hintText, value, pos + shadowOffset, scale,
+                      sf::Color(0, 0, 0, 170));
+    const std::size_t first = hintText.getVertexCount();
+    hintGlyphs.append(hintText, value, pos, scale,
+                      clueColor(isRow, line, index));
+    clueText.push_back({first, hintText.getVertexCount() - first});
+  };
+
+  // Lines scrolled out of view keep an empty range of clues
+  for (int i = 0; i < hints.get_row_count(); ++i) {
+    const auto count = static_cast<int>(hints.get_row(i).size());
+    for (int j = 0; j < count && layout.isLineVisible(true, i); ++j)
+      placeClue(true, i, j, 2.0f * uiScale);
+    lineClueStart.push_back(clueText.size());
+  }
+
+  for (int j = 0; j < hints.get_col_count(); ++j) {
+    const auto count = static_cast<int>(hints.get_col(j).size());
+    for (int i = 0; i < count && layout.isLineVisible(false, j); ++i)
+      placeClue(false, j, i, 4.0f * uiScale);
+    lineClueStart.push_back(clueText.size());
+  }
+
+  hintWebVersion = hints.get_web_version();
+  hintsDirty = false;
+}
+
+void GridRenderer::rebuildLayers() const {
+  const float cellSize = layout.getCellSize();
+  layerRange = layout.visibleCells();
+  const std::size_t cells =
+      static_cast<std::size_t>(layerRange.rows) * layerRange.cols;
+  slotLayer.resize(cells * 6);
+  glassLayer.resize(cells * 6);
+  crossLayer.resize(cells * 12);
+  glassPhase.resize(cells);
+
+  const sf::FloatRect slotTex(slotRegion.rect);
+  for (int i = layerRange.firstRow; i < layerRange.firstRow + layerRange.rows;
+       ++i) {
+    for (int j = layerRange.firstCol;
+         j < layerRange.firstCol + layerRange.cols; ++j) {
+      const std::size_t cell = layerCell(i, j);
+      setQuad(slotLayer, cell * 6,
+              {layout.cellPosition(i, j), {cellSize, cellSize}}, slotTex);
+
+      // Same per-cell pattern DiscoFever always used, hashed once per board
+      const size_t h = std::hash<int>{}(i) ^ (std::hash<int>{}(j) << 1);
+      glassPhase[cell] = static_cast<std::uint8_t>(h % glassRegions.size());
+      updateGlassCell(i, j);
+      updateCrossCell(i, j);
+    }
+  }
+  glassLayerOffset = isDiscoFeverMode ? currentColorOffset : -1;
+  grid->clear_changed_cells();
+  layersDirty = false;
+}
+
+void GridRenderer::updateGlassCell(int row, int col) const {
+  if (!layerRange.contains(row, col))
+    return;
+  const std::size_t cell = layerCell(row, col);
+  const std::size_t first = cell * 6;
+  const float cellSize = layout.getCellSize();
+  const sf::Vector2f pos = layout.cellPosition(row, col);
+  if (!grid->is_filled(row, col)) {
+    // Degenerate triangles cover no pixels
+    const sf::Vector2f center = pos + sf::Vector2f{cellSize, cellSize} / 2.0f;
+    setQuad(glassLayer, first, {center, {0.f, 0.f}}, {});
+    return;
+  }
+
+  std::size_t colorIndex = static_cast<std::size_t>(defaultGlassColorIndex);
+  if (isDiscoFeverMode) {
+    colorIndex = (glassPhase[cell] +
+                  static_cast<std::size_t>(currentColorOffset)) %
+                 glassRegions.size();
+  }
+  const float inset = cellSize * 0.05f; // glass covers 90% of the slot
+  setQuad(glassLayer, first,
+          {pos + sf::Vector2f{inset, inset},
+           {cellSize - 2 * inset, cellSize - 2 * inset}},
+          sf::FloatRect(glassRegions[colorIndex].rect));
+}
+
+bool GridRenderer::glassShown(int row, int col) const {
+  if (!layerRange.contains(row, col))
+    return grid->is_filled(row, col); // not built, nothing to compare
+  const std::size_t first = layerCell(row, col) * 6;
+  return glassLayer[first].position != glassLayer[first + 2].position;
+}
+
+void GridRenderer::updateCrossCell(int row, int col) const {
+  if (!layerRange.contains(row, col))
+    return;
+  const std::size_t first = layerCell(row, col) * 12;
+  const float cellSize = layout.getCellSize();
+  const sf::Vector2f pos = layout.cellPosition(row, col);
+  if (grid->is_crossed(row, col) && !grid->is_filled(row, col)) {
+    setCross(crossLayer, first, pos, cellSize);
+    return;
+  }
+  const sf::Vector2f center = pos + sf::Vector2f{cellSize, cellSize} / 2.0f;
+  for (std::size_t k = 0; k < 12; ++k)
+    crossLayer[first + k] = sf::Vertex{center, sf::Color::Transparent};
 }
 
 void GridRenderer::drawGameInfo(sf::RenderWindow &window) const {
@@ -122,15 +448,15 @@ void GridRenderer::drawGameInfo(sf::RenderWindow &window) const {
   bool hasHunger = false;
   bool hasSaturation = false;
   
-  if (const auto* alchemyMode = findAlchemyMode(grid.getMode())) {
+  if (const auto* alchemyMode = findAlchemyMode(grid->getMode())) {
     hasHunger = alchemyMode->hasEffect(EffectType::Hunger);
     hasSaturation = alchemyMode->hasEffect(EffectType::Saturation);
   }
   
-  int currentMistakes = grid.get_mistakes();
+  int currentMistakes = grid->get_mistakes();
 
   if (const_cast<MinecraftHUD&>(minecraftHUD).update(dt, hasHunger, hasSaturation)) {
-      const_cast<Grid&>(grid).damagePlayer();
+      grid->damagePlayer();
   }
   
   if (currentMistakes != lastMistakes) {
@@ -138,19 +464,19 @@ void GridRenderer::drawGameInfo(sf::RenderWindow &window) const {
     heartDisplay.triggerFlash();
   }
   lastMistakes = currentMistakes;
-  int maxMistakes = grid.get_max_mistakes();
-  int score = grid.get_score();
+  int maxMistakes = grid->get_max_mistakes();
+  int score = grid->get_score();
 
   // Show poisoned hearts if Poison effect is active
   // Show withered hearts if Time Mode is active (and not poisoned)
   bool isPoisoned = false;
-  if (const auto* alchemyMode = findAlchemyMode(grid.getMode())) {
+  if (const auto* alchemyMode = findAlchemyMode(grid->getMode())) {
     isPoisoned = alchemyMode->hasEffect(EffectType::Poison);
   }
   
-  bool isWithered = grid.is_time_mode();
+  bool isWithered = grid->is_time_mode();
   
-  bool showStats = grid.shouldShowSurvivalStats();
+  bool showStats = grid->shouldShowSurvivalStats();
 
   sf::View originalView = window.getView();
   window.setView(window.getDefaultView());
@@ -163,72 +489,84 @@ void GridRenderer::drawGameInfo(sf::RenderWindow &window) const {
   hud.setMaxHealth(maxMistakes);
   
   hud.draw(window, score, currentMistakes, maxMistakes, isPoisoned, hasHunger, isWithered);
-  
-  window.setView(originalView);
-}
-
-void GridRenderer::drawHintTabs(sf::RenderWindow &window) const {
-  const auto &hints = grid.get_hints();
-  size_t maxRowWidth = hints.get_max_row_width();
-  size_t maxColHeight = hints.get_max_col_height();
 
-  float rowHintsWidth = static_cast<float>(maxRowWidth) * cellSize * 0.8f;
-  float colHintsHeight = static_cast<float>(maxColHeight) * cellSize * 0.8f;
+  if (showDrawStats) {
+    std::ostringstream stats;
+    stats << "Board draw calls: " << drawStats.drawCalls
+          << "\nCached per frame: " << drawStats.cachedDrawCalls
+          << "\nStatic layer redraws: " << drawStats.staticRedraws
+          << "\nHUD redraws: " << minecraftHUD.getRedrawCount();
+    const ResourceCache &cache = ResourceCache::shared();
+    stats << "\nAssets cached: " << cache.size() << " (hits "
+          << cache.getStats().hits << ", loads " << cache.getStats().misses
+          << ")";
+    sf::Text text(*font, stats.str(), 16);
+    text.setPosition({8.f, 8.f});
+    text.setFillColor(sf::Color::White);
+    text.setOutlineColor(sf::Color::Black);
+    text.setOutlineThickness(1.f);
+    window.draw(text);
+  }
 
-  sf::Vector2f gridOffset = {offset.x + rowHintsWidth,
-                             offset.y + colHintsHeight};
+  window.setView(originalView);
+}
 
-  auto winSize = window.getSize();
-  float scaleX = static_cast<float>(winSize.x) / 1280.0f;
-  float scaleY = static_cast<float>(winSize.y) / 720.0f;
-  float uiScale = std::min(scaleX, scaleY);
+void GridRenderer::drawHintTabs(sf::RenderTarget &target) const {
+  const auto &hints = grid->get_hints();
+  const sf::Vector2f clueEdge = layout.getClueEdge();
+  const float cellSize = layout.getCellSize();
+  const float uiScale = layout.getUiScale();
 
-  int n = grid.get_size();
+  int n = grid->get_size();
   float padding = 4.0f * uiScale;
 
   float tabWidth = cellSize - padding;
 
 
-  sf::Sprite capSprite(hintTabTexture);
-  sf::Sprite bodySprite(hintTabTexture);
+  sf::Sprite capSprite(*hintTabRegion.page);
+  sf::Sprite bodySprite(*hintTabRegion.page);
 
-  int texW = static_cast<int>(hintTabTexture.getSize().x);
-  int texH = static_cast<int>(hintTabTexture.getSize().y);
+  const sf::Vector2i tabOrigin = hintTabRegion.rect.position;
+  int texW = hintTabRegion.rect.size.x;
+  int texH = hintTabRegion.rect.size.y;
   int capH = 6;
   int bodyH = texH - capH;
 
-  capSprite.setTextureRect(sf::IntRect({0, 0}, {texW, capH}));
-  bodySprite.setTextureRect(sf::IntRect({0, capH}, {texW, bodyH}));
+  capSprite.setTextureRect(sf::IntRect(tabOrigin, {texW, capH}));
+  bodySprite.setTextureRect(
+      sf::IntRect(tabOrigin + sf::Vector2i{0, capH}, {texW, bodyH}));
 
   float spriteScaleX = tabWidth / static_cast<float>(texW);
-  float slotHeight = cellSize * 0.8f;
+  float slotHeight = layout.getSlotHeight();
   float spriteScaleY_Body = slotHeight / static_cast<float>(bodyH);
   float spriteScaleY_Cap = spriteScaleX;
 
   bodySprite.setScale({spriteScaleX, spriteScaleY_Body});
   capSprite.setScale({spriteScaleX, spriteScaleY_Cap});
 
-  const auto &colHints = hints.get_col_hints();
   for (int j = 0; j < n; ++j) {
-    float x = gridOffset.x + static_cast<float>(j) * cellSize + padding / 2.0f;
+    if (!layout.isLineVisible(false, j))
+      continue;
+    float x = layout.cellPosition(0, j).x + padding / 2.0f;
 
-    float bottomY = gridOffset.y - 8.0f * uiScale;
+    float bottomY = clueEdge.y - 8.0f * uiScale;
 
-    size_t currentColHeight = colHints[j].size();
+    size_t currentColHeight =
+        std::min(hints.get_col(j).size(), layout.visibleSlots(false));
     if (currentColHeight == 0)
       currentColHeight = 1;
 
     for (size_t k = 0; k < currentColHeight; ++k) {
       float y = bottomY - static_cast<float>(k + 1) * slotHeight;
       bodySprite.setPosition({x, y});
-      window.draw(bodySprite);
+      drawCounted(target, bodySprite);
     }
 
     float capY = bottomY - static_cast<float>(currentColHeight) * slotHeight -
                  (static_cast<float>(capH) * spriteScaleY_Cap);
 
     capSprite.setPosition({x, capY});
-    window.draw(capSprite);
+    drawCounted(target, capSprite);
   }
 
 
@@ -238,12 +576,14 @@ void GridRenderer::drawHintTabs(sf::RenderWindow &window) const {
   bodySprite.setOrigin({0.f, 0.f});
   capSprite.setOrigin({0.f, 0.f});
 
-  const auto &rowHints = hints.get_row_hints();
   for (int i = 0; i < n; ++i) {
-    float y = gridOffset.y + static_cast<float>(i) * cellSize + padding / 2.0f;
-    float rightX = gridOffset.x - 14.0f * uiScale;
+    if (!layout.isLineVisible(true, i))
+      continue;
+    float y = layout.cellPosition(i, 0).y + padding / 2.0f;
+    float rightX = clueEdge.x - 14.0f * uiScale;
 
-    size_t currentRowWidth = rowHints[i].size();
+    size_t currentRowWidth =
+        std::min(hints.get_row(i).size(), layout.visibleSlots(true));
     if (currentRowWidth == 0)
       currentRowWidth = 1;
 
@@ -255,7 +595,7 @@ void GridRenderer::drawHintTabs(sf::RenderWindow &window) const {
       float slotY = y + visualBodyHeight;
 
       bodySprite.setPosition({slotX, slotY});
-      window.draw(bodySprite);
+      drawCounted(target, bodySprite);
     }
 
     float visualCapWidth = capSprite.getGlobalBounds().size.x;
@@ -268,7 +608,7 @@ void GridRenderer::drawHintTabs(sf::RenderWindow &window) const {
     float capY = y + visualCapHeight;
 
     capSprite.setPosition({capX, capY});
-    window.draw(capSprite);
+    drawCounted(target, capSprite);
   }
 
   bodySprite.setRotation(sf::degrees(0.f));
@@ -277,6 +617,41 @@ void GridRenderer::drawHintTabs(sf::RenderWindow &window) const {
   capSprite.setOrigin({0.f, 0.f});
 }
 
+void GridRenderer::drawCounted(sf::RenderTarget &target,
+                               const sf::Drawable &drawable,
+                               const sf::RenderStates &states) const {
+  ++drawStats.drawCalls;
+  target.draw(drawable, states);
+}
+
+void GridRenderer::redrawStaticLayer(sf::Vector2u size) const {
+  if (size != staticLayerSize) {
+    if (!staticLayer.resize(size)) {
+      throw AssetLoadException("static board layer", "Render Texture");
+    }
+    staticLayerSize = size;
+  }
+
+  // Counted separately: these draws happen once here instead of every frame
+  const int windowDraws = drawStats.drawCalls;
+  drawStats.drawCalls = 0;
+  staticLayer.clear(sf::Color::Transparent);
+  drawHintTabs(staticLayer);
+  drawCounted(staticLayer, backgroundPatch);
+  if (layout.hasCamera()) {
+    staticLayer.setView(clipView(layout.getViewport(), size));
+    drawCounted(staticLayer, slotLayer, slotRegion.page);
+    staticLayer.setView(staticLayer.getDefaultView());
+  } else {
+    drawCounted(staticLayer, slotLayer, slotRegion.page);
+  }
+  staticLayer.display();
+  drawStats.cachedDrawCalls = drawStats.drawCalls;
+  drawStats.drawCalls = windowDraws;
+  ++drawStats.staticRedraws;
+  staticDirty = false;
+}
+
 void GridRenderer::draw(sf::RenderWindow &window) const {
   // Helper to find AlchemyMode in decorator chain  
   auto findAlchemyMode = [](GameMode* mode) -> AlchemyMode* {
@@ -313,433 +688,221 @@ void GridRenderer::draw(sf::RenderWindow &window) const {
     }
   }
 
-  const auto &hints = grid.get_hints();
-  int n = grid.get_size();
-
-  size_t maxRowWidth = hints.get_max_row_width();
-  size_t maxColHeight = hints.get_max_col_height();
-
-  float rowHintsWidth = static_cast<float>(maxRowWidth) * cellSize * 0.8f;
-  float colHintsHeight = static_cast<float>(maxColHeight) * cellSize * 0.8f;
-
-  sf::Vector2f gridOffset = {offset.x + rowHintsWidth,
-                             offset.y + colHintsHeight};
-
-  drawHintTabs(window);
-
-  // Draw Background
-  float gridWidth = static_cast<float>(n) * cellSize;
-  float gridHeight = gridWidth;
-  float padding = 16.0f;
-
-  auto winSize = window.getSize();
-  float scaleX = static_cast<float>(winSize.x) / 1280.0f;
-  float scaleY = static_cast<float>(winSize.y) / 720.0f;
-  float uiScale = std::min(scaleX, scaleY);
-
-
-
-  float patchScale = std::round(uiScale);
-  if (patchScale < 1.f) patchScale = 1.f;
-
-  auto &mutablePatch = const_cast<NinePatch &>(backgroundPatch);
-  mutablePatch.setPixelSnapping(true);
-  mutablePatch.setPatchScale(patchScale);
-
+  const auto &hints = grid->get_hints();
+  int n = grid->get_size();
+
+  drawStats.drawCalls = 0;
+
+  const auto winSize = window.getSize();
+  if (winSize != layout.getWindowSize())
+    relayout(winSize);
+  const sf::Vector2f gridOffset = layout.getGridOrigin();
+  const float cellSize = layout.getCellSize();
+  const float uiScale = layout.getUiScale();
+  const sf::FloatRect panel = layout.getPanel();
+
+  // The minimap reads the changed cells before the layers clear them
+  if (layout.hasCamera()) {
+    if (minimapDirty || minimap.getBoardSize() != n) {
+      minimap.rebuild(*grid);
+      minimapDirty = false;
+    } else {
+      minimap.update(*grid, grid->get_changed_cells());
+    }
+  }
 
+  // The slot layer is part of the cached image, so it is brought up to date
+  // before deciding whether that image needs redrawing.
+  bool slotsRebuilt = false;
+  if (layersDirty || layout.visibleCells() != layerRange) {
+    rebuildLayers();
+    slotsRebuilt = true;
+  }
 
-  float scaledPadding = std::round(padding * uiScale);
+  if (staticDirty || slotsRebuilt) {
+    auto &mutablePatch = const_cast<NinePatch &>(backgroundPatch);
+    mutablePatch.setPixelSnapping(true);
+    mutablePatch.setPatchScale(layout.getPanelScale());
+    mutablePatch.setSize(panel.size.x, panel.size.y);
+    mutablePatch.setPosition(panel.position);
+    redrawStaticLayer(winSize);
+  }
+  // Alpha blending into a transparent layer leaves its colours already
+  // multiplied by their alpha; blending them by alpha again would darken
+  // and thin every semi-transparent edge.
+  const sf::BlendMode premultipliedAlpha(
+      sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+  sf::Sprite staticSprite(staticLayer.getTexture());
+  drawCounted(window, staticSprite, premultipliedAlpha);
 
-  float bgWidth  = std::round(gridWidth + scaledPadding * 2);
-  float bgHeight = std::round(gridHeight + scaledPadding * 2);
-  
-  mutablePatch.setSize(bgWidth, bgHeight);
-  
-  sf::Vector2f bgPos = {
-    std::round(gridOffset.x - scaledPadding),
-    std::round(gridOffset.y - scaledPadding)
-  };
-  mutablePatch.setPosition(bgPos);
-  window.draw(backgroundPatch);
-  
   // Draw effects to the right of the grid
   // Get effects from AlchemyMode if active
   
   std::vector<ActiveEffect> activeEffects;
-  if (const auto* alchemyMode = findAlchemyMode(grid.getMode())) {
+  if (const auto* alchemyMode = findAlchemyMode(grid->getMode())) {
     activeEffects = alchemyMode->getActiveEffects();
   }
   
   if (!activeEffects.empty()) {
     float effectPadding = 10.0f * uiScale;
     sf::Vector2f effectPos;
-    effectPos.x = bgPos.x + bgWidth + effectPadding;
-    effectPos.y = bgPos.y;
+    effectPos.x = panel.position.x + panel.size.x + effectPadding;
+    effectPos.y = panel.position.y;
     
     effectDisplay.draw(window, uiScale, activeEffects, effectPos);
   }
 
-  if (true) {
-    const auto &rowHints = hints.get_row_hints();
-    for (size_t i = 0; i < rowHints.size(); ++i) {
-      float rowY =
-          gridOffset.y + static_cast<float>(i) * cellSize + cellSize * 0.5f;
-      float slotHeight = cellSize * 0.8f;
-
-      for (int j = static_cast<int>(rowHints[i].size()) - 1; j >= 0; --j) {
-        int k = static_cast<int>(rowHints[i].size()) - 1 - j;
-
-        float slotCenter = gridOffset.x - (static_cast<float>(k) * slotHeight) -
-                           (slotHeight / 2.0f);
-        slotCenter -= 16.0f * uiScale;
-        unsigned int fontSize = static_cast<unsigned int>(
-            std::min(28.f * uiScale, cellSize * 0.5f));
-
-        if (grid.isHintWebbed(true, static_cast<int>(i), j)) {
-          sf::Sprite webSprite(webTexture);
-          float scale =
-              (cellSize * 0.6f) / static_cast<float>(webTexture.getSize().x);
-          webSprite.setScale({scale, scale});
-          webSprite.setOrigin(
-              {static_cast<float>(webTexture.getSize().x) / 2.f,
-               static_cast<float>(webTexture.getSize().y) / 2.f});
-
-          sf::Text tempText(font, std::to_string(rowHints[i][j]));
-          tempText.setCharacterSize(fontSize);
-          auto bounds = tempText.getLocalBounds();
-
-          float maxWidth = slotHeight * 0.9f;
-          if (bounds.size.x > maxWidth) {
-            float scaleFactor = maxWidth / bounds.size.x;
-            tempText.setScale({scaleFactor, scaleFactor});
-            bounds = tempText.getGlobalBounds(); // Update bounds
-          }
-
-          // Center text
-          float textX =
-              std::round(slotCenter - bounds.size.x / 2.0f - bounds.position.x);
-          float textY =
-              std::round(rowY - bounds.size.y * 0.5f - bounds.position.y);
-
-          webSprite.setPosition({textX + bounds.size.x / 2.f,
-                                 textY + bounds.size.y / 2.f + 2.0f * uiScale});
-          window.draw(webSprite);
-
-          // Draw break texture
-          int health =
-              grid.get_hints().getWebHealth(true, static_cast<int>(i), j);
-          if (health < 10) {
-            int stage = 9 - health; // 9 down to 0
-            if (stage >= 0 && stage < static_cast<int>(breakTextures.size())) {
-              sf::Sprite breakSprite(breakTextures[stage]);
-              breakSprite.setScale({scale, scale});
-              breakSprite.setOrigin(webSprite.getOrigin());
-              breakSprite.setPosition(webSprite.getPosition());
-              window.draw(breakSprite);
-            }
-          }
-        } else {
-          sf::Text text(font, std::to_string(rowHints[i][j]));
-          text.setCharacterSize(fontSize);
-          text.setFillColor(sf::Color::White);
-
-          auto bounds = text.getLocalBounds();
-
-          // Constrain width if too wide
-          float maxWidth = slotHeight * 0.9f;
-          if (bounds.size.x > maxWidth) {
-            float scaleFactor = maxWidth / bounds.size.x;
-            text.setScale({scaleFactor, scaleFactor});
-            bounds = text.getGlobalBounds(); // Update bounds
-          }
-
-          float textX =
-              std::round(slotCenter - bounds.size.x / 2.0f - bounds.position.x);
-          float textY =
-              std::round(rowY - bounds.size.y * 0.5f - bounds.position.y);
-
-          text.setPosition({textX, textY});
-
-          ShadowedText::draw(window, text, uiScale);
-        }
+  const float webScale =
+      (cellSize * 0.6f) / static_cast<float>(webRegion.rect.size.x);
+  if (hintsDirty || hints.get_web_version() != hintWebVersion) {
+    rebuildHintText();
+  } else {
+    // Only dimming changes between rebuilds; recolour the clues of lines
+    // whose satisfaction flipped.
+    const int rows = hints.get_row_count();
+    for (const int id : grid->get_lines().get_dirty_lines()) {
+      const bool isRow = id < rows;
+      const int line = isRow ? id : id - rows;
+      for (std::size_t c = lineClueStart[id]; c < lineClueStart[id + 1];
+           ++c) {
+        const sf::Color color = clueColor(
+            isRow, line, static_cast<int>(c - lineClueStart[id]));
+        for (std::size_t v = 0; v < clueText[c].count; ++v)
+          hintText[clueText[c].first + v].color = color;
       }
     }
-
-    const auto &colHints = hints.get_col_hints();
-    for (size_t j = 0; j < colHints.size(); ++j) {
-      float colX =
-          gridOffset.x + static_cast<float>(j) * cellSize + cellSize * 0.5f;
-      float slotHeight = cellSize * 0.8f;
-
-      for (int i = static_cast<int>(colHints[j].size()) - 1; i >= 0; --i) {
-        int k = static_cast<int>(colHints[j].size()) - 1 - i;
-
-        float slotCenterY = gridOffset.y -
-                            (static_cast<float>(k) * slotHeight) -
-                            (slotHeight / 2.0f);
-        slotCenterY -= 16.0f * uiScale;
-
-
-
-        unsigned int fontSize = static_cast<unsigned int>(
-            std::min(28.f * uiScale, cellSize * 0.5f));
-
-        if (grid.isHintWebbed(false, static_cast<int>(j), i)) {
-          sf::Sprite webSprite(webTexture);
-          float scale =
-              (cellSize * 0.6f) / static_cast<float>(webTexture.getSize().x);
-          webSprite.setScale({scale, scale});
-          webSprite.setOrigin(
-              {static_cast<float>(webTexture.getSize().x) / 2.f,
-               static_cast<float>(webTexture.getSize().y) / 2.f});
-
-          sf::Text tempText(font, std::to_string(colHints[j][i]));
-          tempText.setCharacterSize(fontSize);
-          auto bounds = tempText.getLocalBounds();
-
-          float maxWidth = (cellSize - padding) * 0.9f;
-          if (bounds.size.x > maxWidth) {
-            float scaleFactor = maxWidth / bounds.size.x;
-            tempText.setScale({scaleFactor, scaleFactor});
-            bounds = tempText.getGlobalBounds();
-          }
-
-          float textX =
-              std::round(colX - bounds.size.x * 0.5f - bounds.position.x);
-          float textY = std::round(slotCenterY - bounds.size.y * 0.5f -
-                                   bounds.position.y);
-
-          webSprite.setPosition({textX + bounds.size.x / 2.f,
-                                 textY + bounds.size.y / 2.f + 4.0f * uiScale});
-          window.draw(webSprite);
-
-          // Draw break texture
-          int health =
-              grid.get_hints().getWebHealth(false, static_cast<int>(j), i);
-          if (health < 10) {
-            int stage = 9 - health; // 9 down to 0
-            if (stage >= 0 && stage < static_cast<int>(breakTextures.size())) {
-              sf::Sprite breakSprite(breakTextures[stage]);
-              breakSprite.setScale({scale, scale});
-              breakSprite.setOrigin(webSprite.getOrigin());
-              breakSprite.setPosition(webSprite.getPosition());
-              window.draw(breakSprite);
-            }
-          }
-        } else {
-          sf::Text text(font, std::to_string(colHints[j][i]));
-          text.setCharacterSize(fontSize);
-          text.setFillColor(sf::Color::White);
-
-          auto bounds = text.getLocalBounds();
-
-          // Constrain width if too wide
-          float maxWidth = (cellSize - padding) * 0.9f;
-          if (bounds.size.x > maxWidth) {
-            float scaleFactor = maxWidth / bounds.size.x;
-            text.setScale({scaleFactor, scaleFactor});
-            bounds = text.getGlobalBounds();
-          }
-
-          float textX =
-              std::round(colX - bounds.size.x * 0.5f - bounds.position.x);
-          float textY = std::round(slotCenterY - bounds.size.y * 0.5f -
-                                   bounds.position.y);
-
-          text.setPosition({textX, textY});
-
-          ShadowedText::draw(window, text, uiScale);
-        }
+  }
+  grid->clear_dirty_lines();
+  drawCounted(window, hintText, &hintGlyphs.getTexture());
+
+  const sf::Vector2f webSize(webRegion.rect.size);
+  for (const WebMarker &marker : webMarkers) {
+    sf::Sprite webSprite(*webRegion.page, webRegion.rect);
+    webSprite.setScale({webScale, webScale});
+    webSprite.setOrigin(webSize / 2.f);
+    webSprite.setPosition(marker.center);
+    drawCounted(window, webSprite);
+
+    // Draw break texture
+    int health = hints.getWebHealth(marker.isRow, marker.line, marker.index);
+    if (health < 10) {
+      int stage = 9 - health; // 9 down to 0
+      if (stage >= 0 && stage < static_cast<int>(breakRegions.size())) {
+        sf::Sprite breakSprite(*breakRegions[stage].page,
+                               breakRegions[stage].rect);
+        breakSprite.setScale({webScale, webScale});
+        breakSprite.setOrigin(webSprite.getOrigin());
+        breakSprite.setPosition(webSprite.getPosition());
+        drawCounted(window, breakSprite);
       }
     }
   }
 
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      sf::Vector2f pos = {gridOffset.x + static_cast<float>(j) * cellSize,
-                          gridOffset.y + static_cast<float>(i) * cellSize};
-
-      // Draw slot texture
-      sf::Sprite slotSprite(blockTexture);
-      float slotScaleX =
-          cellSize / static_cast<float>(blockTexture.getSize().x);
-      float slotScaleY =
-          cellSize / static_cast<float>(blockTexture.getSize().y);
-      slotSprite.setScale({slotScaleX, slotScaleY});
-      slotSprite.setPosition(pos);
-      window.draw(slotSprite);
-
-      if (grid.get_block(i, j).is_completed()) {
-        if (!glassTextures.empty()) {
-          int textureIndex = defaultGlassColorIndex;
-          if (isDiscoFeverMode) {
-            size_t h = std::hash<int>{}(i) ^ (std::hash<int>{}(j) << 1);
-
-            textureIndex = static_cast<int>((h + currentColorOffset) % glassTextures.size());
-          }
-
-          sf::Sprite glassSprite(glassTextures[textureIndex]);
-
-          float glassScaleFactor = 0.9f;
-          float targetSize = cellSize * glassScaleFactor;
-
-          float glassScaleX =
-              targetSize /
-              static_cast<float>(glassTextures[textureIndex].getSize().x);
-          float glassScaleY =
-              targetSize /
-              static_cast<float>(glassTextures[textureIndex].getSize().y);
-
-          glassSprite.setScale({glassScaleX, glassScaleY});
-
-          glassSprite.setOrigin(
-              {static_cast<float>(glassTextures[textureIndex].getSize().x) /
-                   2.0f,
-               static_cast<float>(glassTextures[textureIndex].getSize().y) /
-                   2.0f});
-          glassSprite.setPosition(
-              {pos.x + cellSize / 2.0f, pos.y + cellSize / 2.0f});
-
-          window.draw(glassSprite);
-        } else {
-          float blockPadding = cellSize * 0.15f;
-          sf::RectangleShape rect(sf::Vector2f(cellSize - 2 * blockPadding,
-                                               cellSize - 2 * blockPadding));
-          rect.setPosition({pos.x + blockPadding, pos.y + blockPadding});
-          rect.setFillColor(sf::Color::Black);
-          window.draw(rect);
-        }
+  // Patch the cells toggled since the last frame, then, when the disco
+  // colours moved on, every filled cell's glass as well. The toggled cells
+  // go first so one emptied in the same frame does not keep its glass.
+  // rebuildLayers() has already laid out both layers of a fresh board.
+  const int colorOffset = isDiscoFeverMode ? currentColorOffset : -1;
+  const int lastRow = layerRange.firstRow + layerRange.rows;
+  const auto firstWord = static_cast<std::size_t>(layerRange.firstCol / 64);
+  const auto endWord =
+      static_cast<std::size_t>((layerRange.firstCol + layerRange.cols + 63) / 64);
+  if (!slotsRebuilt) {
+    for (const int cell : grid->get_changed_cells()) {
+      updateGlassCell(cell / n, cell % n);
+      updateCrossCell(cell / n, cell % n);
+    }
+  }
+  if (!slotsRebuilt && colorOffset != glassLayerOffset) {
+    const BitBoard &filledCells = grid->get_filled();
+    for (int i = layerRange.firstRow; i < lastRow; ++i) {
+      const auto words = filledCells.row(i).words();
+      for (std::size_t w = firstWord; w < endWord; ++w) {
+        for (std::uint64_t bits = words[w]; bits; bits &= bits - 1)
+          updateGlassCell(i, static_cast<int>(w) * 64 + std::countr_zero(bits));
       }
     }
+    glassLayerOffset = colorOffset;
+  }
+  if (!slotsRebuilt) {
+    // Every toggled cell must now show glass exactly when it is filled
+    for ([[maybe_unused]] const int cell : grid->get_changed_cells())
+      assert(glassShown(cell / n, cell % n) ==
+             grid->is_filled(cell / n, cell % n));
+    grid->clear_changed_cells();
   }
 
-  grid.drawMode(window);
-}
-
-void GridRenderer::handleClick(const sf::Vector2i &mousePos) const {
-  const auto &hints = grid.get_hints();
-  size_t maxRowWidth = hints.get_max_row_width();
-  size_t maxColHeight = hints.get_max_col_height();
+  // Cells and their overlays are clipped to the viewport under a camera
+  const sf::View boardView = window.getView();
+  if (layout.hasCamera())
+    window.setView(clipView(layout.getViewport(), winSize));
+  drawCounted(window, glassLayer, glassRegions.front().page);
+  drawCounted(window, crossLayer);
+
+  if (moveHint) {
+    // Tint the line whose clues prove the move, then frame the cell: green
+    // if it must be filled, red if it must stay empty.
+    const float gridSize = layout.getGridExtent();
+    const sf::Vector2f cellPos =
+        layout.cellPosition(moveHint->row, moveHint->col);
+
+    sf::RectangleShape line;
+    if (moveHint->isRow) {
+      line.setSize({gridSize, cellSize});
+      line.setPosition({gridOffset.x, cellPos.y});
+    } else {
+      line.setSize({cellSize, gridSize});
+      line.setPosition({cellPos.x, gridOffset.y});
+    }
+    line.setFillColor(sf::Color(255, 255, 120, 60));
+    drawCounted(window, line);
+
+    const float thickness = std::max(2.0f, cellSize * 0.08f);
+    sf::RectangleShape cell(
+        {cellSize - 2 * thickness, cellSize - 2 * thickness});
+    cell.setPosition({cellPos.x + thickness, cellPos.y + thickness});
+    cell.setFillColor(sf::Color::Transparent);
+    cell.setOutlineThickness(thickness);
+    cell.setOutlineColor(moveHint->fill ? sf::Color(80, 220, 80)
+                                        : sf::Color(220, 70, 70));
+    drawCounted(window, cell);
+  }
+  window.setView(boardView);
 
-  float rowHintsWidth = static_cast<float>(maxRowWidth) * cellSize * 0.8f;
-  float colHintsHeight = static_cast<float>(maxColHeight) * cellSize * 0.8f;
+  if (layout.hasCamera())
+    drawMinimap(window);
 
-  sf::Vector2f gridOffset = {offset.x + rowHintsWidth,
-                             offset.y + colHintsHeight};
+  grid->drawMode(window);
+}
 
-  if (static_cast<float>(mousePos.x) < gridOffset.x ||
-      static_cast<float>(mousePos.y) < gridOffset.y)
+void GridRenderer::handleClick(const sf::Vector2i &mousePos,
+                               bool cross) const {
+  const auto cell = layout.cellAt(sf::Vector2f(mousePos));
+  if (!cell)
     return;
 
-  int n = grid.get_size();
-  int x = static_cast<int>((static_cast<float>(mousePos.y) - gridOffset.y) /
-                           cellSize);
-  int y = static_cast<int>((static_cast<float>(mousePos.x) - gridOffset.x) /
-                           cellSize);
-
-  if (x >= 0 && x < n && y >= 0 && y < n)
-    grid.toggle_block(x, y);
+  if (cross)
+    grid->cross_block(cell->x, cell->y);
+  else
+    grid->toggle_block(cell->x, cell->y);
 }
 
 sf::Vector2f GridRenderer::getHintCenter(bool isRow, int line,
                                          int index) const {
-  const auto &hints = grid.get_hints();
-  size_t maxRowWidth = hints.get_max_row_width();
-  size_t maxColHeight = hints.get_max_col_height();
-
-  float rowHintsWidth = static_cast<float>(maxRowWidth) * cellSize * 0.8f;
-  float colHintsHeight = static_cast<float>(maxColHeight) * cellSize * 0.8f;
-
-  sf::Vector2f gridOffset = {offset.x + rowHintsWidth,
-                             offset.y + colHintsHeight};
-
-  if (isRow) {
-    const auto &rowHints = hints.get_row_hints();
-    if (line >= rowHints.size() || index >= rowHints[line].size())
-      return {0, 0};
-
-    float rowY =
-        gridOffset.y + static_cast<float>(line) * cellSize + cellSize * 0.5f;
-    float startX = gridOffset.x - 20.f;
-
-    // Calculate X position based on index (reverse order)
-    int reverseIndex = static_cast<int>(rowHints[line].size()) - 1 - index;
-    float currentX =
-        startX - static_cast<float>(reverseIndex) * (cellSize * 0.8f);
-
-    sf::Text tempText(font, std::to_string(rowHints[line][index]));
-    tempText.setCharacterSize(static_cast<unsigned int>(cellSize * 0.5f));
-    auto bounds = tempText.getLocalBounds();
-
-    float textX = currentX - bounds.size.x - bounds.position.x;
-    float textY = rowY - bounds.size.y * 0.5f - bounds.position.y;
-
-    return {textX + bounds.size.x / 2.f, textY + bounds.size.y / 2.f};
-  } else {
-    const auto &colHints = hints.get_col_hints();
-    if (line >= colHints.size() || index >= colHints[line].size())
-      return {0, 0};
-
-    float colX =
-        gridOffset.x + static_cast<float>(line) * cellSize + cellSize * 0.5f;
-    float startY = gridOffset.y - 10.f;
-
-    int reverseIndex = static_cast<int>(colHints[line].size()) - 1 - index;
-    float currentY =
-        startY - static_cast<float>(reverseIndex) * (cellSize * 0.8f);
-
-    sf::Text tempText(font, std::to_string(colHints[line][index]));
-    tempText.setCharacterSize(static_cast<unsigned int>(cellSize * 0.5f));
-    auto bounds = tempText.getLocalBounds();
-
-    float textX = colX - bounds.size.x * 0.5f - bounds.position.x;
-    float textY = currentY - bounds.size.y - bounds.position.y;
-
-    return {textX + bounds.size.x / 2.f, textY + bounds.size.y / 2.f};
-  }
+  if (index < 0 ||
+      static_cast<std::size_t>(index) >= layout.clueCount(isRow, line))
+    return {0, 0};
+  return layout.clueCenter(isRow, line, index);
 }
 
 Grid::WebDamageResult
 GridRenderer::handleHintClick(const sf::Vector2i &mousePos) const {
-  const auto &hints = grid.get_hints();
-
-  // Check all webbed hints to see if clicked
-  const auto &rowHints = hints.get_row_hints();
-  for (size_t i = 0; i < rowHints.size(); ++i) {
-    for (size_t j = 0; j < rowHints[i].size(); ++j) {
-      if (grid.isHintWebbed(true, static_cast<int>(i), static_cast<int>(j))) {
-        sf::Vector2f center =
-            getHintCenter(true, static_cast<int>(i), static_cast<int>(j));
-        float radius = cellSize * 0.4f; // Approximate hit radius
-
-        float dx = static_cast<float>(mousePos.x) - center.x;
-        float dy = static_cast<float>(mousePos.y) - center.y;
-        if (dx * dx + dy * dy <= radius * radius) {
-          return const_cast<Grid &>(grid).damageWeb(
-              true, static_cast<int>(i), static_cast<int>(j)); // Use damageWeb
-        }
-      }
-    }
-  }
-
-  const auto &colHints = hints.get_col_hints();
-  for (size_t j = 0; j < colHints.size(); ++j) {
-    for (size_t i = 0; i < colHints[j].size(); ++i) {
-      if (grid.isHintWebbed(false, static_cast<int>(j), static_cast<int>(i))) {
-        sf::Vector2f center =
-            getHintCenter(false, static_cast<int>(j), static_cast<int>(i));
-        float radius = cellSize * 0.4f;
-
-        float dx = static_cast<float>(mousePos.x) - center.x;
-        float dy = static_cast<float>(mousePos.y) - center.y;
-        if (dx * dx + dy * dy <= radius * radius) {
-          return const_cast<Grid &>(grid).damageWeb(
-              false, static_cast<int>(j), static_cast<int>(i)); // Use damageWeb
-        }
-      }
-    }
-  }
-  return Grid::WebDamageResult::None;
+  // Webbed state is read live, so webHint/unwebHint need no bookkeeping here
+  const auto slot = layout.clueAt(sf::Vector2f(mousePos));
+  if (!slot || !grid->isHintWebbed(slot->isRow, slot->line, slot->index))
+    return Grid::WebDamageResult::None;
+  return grid->damageWeb(slot->isRow, slot->line,
+                                            slot->index);
 }
 
 
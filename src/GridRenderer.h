@@ -7,33 +7,50 @@
 
 #include "Grid.h"
 #include "HeartDisplay.h"
+#include "HintAssistant.h"
 #include "MinecraftHUD.h"
 #include "EffectDisplay.h"
+#include "GlyphStrip.h"
 #include "AlchemyMode.h"
+#include "BoardLayout.h"
+#include "BoardMinimap.h"
 #include "NinePatch.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// Draw calls issued by GridRenderer::draw() itself; mode overlays and the
+// HUD are not included.
+struct DrawStats {
+  int drawCalls = 0;       // last frame, to the window
+  int cachedDrawCalls = 0; // draws replaced by the static layer each frame
+  int staticRedraws = 0;   // times the static layer was re-rendered
+};
 
 class GridRenderer {
-  Grid &grid;
-  float cellSize;
-  sf::Vector2f offset;
-  sf::Font font;
+  Grid *grid; // never null; replaced by bind()
+  mutable BoardLayout layout; // refitted in place when the window resizes
+  std::shared_ptr<const sf::Font> font;
   mutable HeartDisplay heartDisplay;
   mutable MinecraftHUD minecraftHUD;
   mutable EffectDisplay effectDisplay;
   mutable int lastMistakes;
   mutable ::sf::Clock animationClock;
 
-  sf::Texture webTexture;
-  std::vector<sf::Texture> breakTextures;
-
-  sf::Texture backgroundTexture;
-  sf::Texture blockTexture;
-  sf::Texture hintTabTexture;
+  std::shared_ptr<const sf::Texture> backgroundTexture;
   NinePatch backgroundPatch;
-  NinePatch hintTabPatch;
 
-  std::vector<sf::Texture> glassTextures;
+  // Sub-rects of the shared TextureAtlas::game() page. All glass colours
+  // sit on one page, so the glass layer can switch colour per cell
+  // through texture coordinates alone.
+  AtlasRegion webRegion;
+  std::vector<AtlasRegion> breakRegions;
+  AtlasRegion slotRegion;
+  AtlasRegion hintTabRegion;
+  std::vector<AtlasRegion> glassRegions;
   bool isDiscoFeverMode;
   int defaultGlassColorIndex;
 
@@ -41,21 +58,127 @@ class GridRenderer {
   mutable float colorTimer;
   mutable int currentColorOffset;
 
+  std::optional<MoveHint> moveHint;
+
+  bool dragging = false; // middle-button camera pan in progress
+  sf::Vector2i dragFrom;
+  bool minimapHeld = false; // left button down on the minimap
+
+  // Overview of the whole board, kept only while the layout has a camera.
+  mutable BoardMinimap minimap;
+  mutable bool minimapDirty = true;
+  void drawMinimap(sf::RenderTarget &target) const;
+
+  // Board cells as batched layers, one entry per cell of layerRange in
+  // row-major order: six vertices (two triangles) for slots and glass,
+  // twelve for the two strokes of a cross. Slots only change with the
+  // layout; glass and crosses are collapsed to a point while their cell
+  // shows neither and are patched from Grid::get_changed_cells() when the
+  // player toggles it. With a camera only the cells in view are built.
+  mutable sf::VertexArray slotLayer{sf::PrimitiveType::Triangles};
+  mutable sf::VertexArray glassLayer{sf::PrimitiveType::Triangles};
+  mutable sf::VertexArray crossLayer{sf::PrimitiveType::Triangles};
+  mutable CellRange layerRange;
+  mutable std::vector<std::uint8_t> glassPhase; // per-cell disco colour shift
+  mutable int glassLayerOffset = -1; // colour offset the glass was built for
+  mutable bool layersDirty = true;
+
+  // Clue numbers and their shadows as quads over a digit strip, laid out
+  // once per layout and set of webbed clues. Between rebuilds only
+  // the colours of lines whose satisfaction changed are rewritten.
+  struct ClueText {
+    std::size_t first; // first vertex of the clue's own (non-shadow) quads
+    std::size_t count;
+  };
+  struct WebMarker {
+    bool isRow;
+    int line;
+    int index;
+    sf::Vector2f center;
+  };
+  mutable GlyphStrip hintGlyphs;
+  mutable sf::VertexArray hintText{sf::PrimitiveType::Triangles};
+  mutable std::vector<ClueText> clueText;         // hint order, rows first
+  mutable std::vector<std::size_t> lineClueStart; // per line, into clueText
+  mutable std::vector<WebMarker> webMarkers;
+  mutable std::uint32_t hintWebVersion = 0;
+  mutable bool hintsDirty = true;
+
+  // Hint tabs, the background panel and the slot grid never change while a
+  // puzzle is shown, so they are rendered once into a window-sized texture
+  // and composited with a single sprite, blended as premultiplied alpha.
+  // Redrawn when the layout or the slot layer changes, or after
+  // invalidateStaticLayer().
+  mutable sf::RenderTexture staticLayer;
+  mutable sf::Vector2u staticLayerSize;
+  mutable bool staticDirty = true;
+
+  mutable DrawStats drawStats;
+  bool showDrawStats = false;
+
+  // window.draw() that counts towards drawStats.
+  void drawCounted(sf::RenderTarget &target, const sf::Drawable &drawable,
+                   const sf::RenderStates &states = sf::RenderStates::Default) const;
+  void redrawStaticLayer(sf::Vector2u size) const;
+
+  [[nodiscard]] sf::Color clueColor(bool isRow, int line, int index) const;
+  void rebuildHintText() const;
+  void rebuildLayers() const;
+  void updateGlassCell(int row, int col) const;
+  void updateCrossCell(int row, int col) const;
+  // Whether the glass layer covers the cell; for the debug-build check
+  // that toggled cells were patched.
+  [[nodiscard]] bool glassShown(int row, int col) const;
+  [[nodiscard]] std::size_t layerCell(int row, int col) const {
+    return static_cast<std::size_t>(row - layerRange.firstRow) *
+               layerRange.cols +
+           (col - layerRange.firstCol);
+  }
+  void relayout(sf::Vector2u windowSize) const;
+  void layoutChanged() const;
+
 public:
-  explicit GridRenderer(Grid &g, float size = 40.f,
-                        sf::Vector2f offset = {50.f, 50.f});
+  GridRenderer(Grid &g, sf::Vector2u windowSize);
 
   ~GridRenderer() = default;
 
+  // Shows a new puzzle: points the renderer at g, fits the layout to the
+  // window and drops everything cached for the previous board. Textures,
+  // fonts and render targets are kept, so nothing is read from disk.
+  void bind(Grid &g, sf::Vector2u windowSize);
+
   void setDiscoFeverMode(bool enabled);
 
+  // Refits the layout to a new window size; draw() also does this on its
+  // own when it sees the window change.
+  void resize(sf::Vector2u windowSize) { relayout(windowSize); }
+
+  [[nodiscard]] const BoardLayout &getLayout() const { return layout; }
+
+  // Wheel zoom, middle-button drag pan and minimap clicks on boards with a
+  // camera. Returns true if the event was used.
+  bool handleCameraEvent(const sf::Event &event);
+
+  // Cell (and proving line) to highlight, or nullopt for none.
+  void setMoveHint(std::optional<MoveHint> hint) { moveHint = hint; }
+
   void draw(sf::RenderWindow &window) const;
 
-  void drawHintTabs(sf::RenderWindow &window) const;
+  void drawHintTabs(sf::RenderTarget &target) const;
+
+  // Forces the cached tabs, background and slots to be redrawn next frame.
+  void invalidateStaticLayer() { staticDirty = true; }
+
+  [[nodiscard]] const DrawStats &getDrawStats() const { return drawStats; }
+
+  // Draw-call overlay in the top-left corner, drawn by drawGameInfo().
+  void setShowDrawStats(bool show) { showDrawStats = show; }
+  [[nodiscard]] bool isShowingDrawStats() const { return showDrawStats; }
 
   void drawGameInfo(sf::RenderWindow &window) const;
 
-  void handleClick(const sf::Vector2i &mousePos) const;
+  // Left click fills/clears a cell, right click (cross = true) marks it.
+  void handleClick(const sf::Vector2i &mousePos, bool cross = false) const;
 
   Grid::WebDamageResult handleHintClick(const sf::Vector2i &mousePos) const;
 
@@ -1,82 +1,38 @@
 #include "HeartDisplay.h"
-#include "Exceptions.h"
+#include "TextureAtlas.h"
+#include <algorithm>
 #include <random>
 
 HeartDisplay::HeartDisplay() : isFlashing(false), flashTimer(0.0f) {
-  if (!containerTexture.loadFromFile("assets/hearts/container_hardcore.png")) {
-    throw AssetLoadException("assets/hearts/container_hardcore.png", "Texture");
-  }
-  if (!containerBlinkingTexture.loadFromFile(
-          "assets/hearts/container_hardcore_blinking.png")) {
-    throw AssetLoadException("assets/hearts/container_hardcore_blinking.png",
-                             "Texture");
-  }
+  const TextureAtlas &atlas = TextureAtlas::game();
+  containerRegion = atlas.region("hearts/container_hardcore");
+  containerBlinkingRegion = atlas.region("hearts/container_hardcore_blinking");
 
-  if (!fullHeartTexture.loadFromFile("assets/hearts/hardcore_full.png")) {
-    throw AssetLoadException("assets/hearts/hardcore_full.png", "Texture");
-  }
-  if (!fullHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/hardcore_full_blinking.png")) {
-    throw AssetLoadException("assets/hearts/hardcore_full_blinking.png",
-                             "Texture");
-  }
+  fullHeartRegion = atlas.region("hearts/hardcore_full");
+  fullHeartBlinkingRegion = atlas.region("hearts/hardcore_full_blinking");
 
-  if (!halfHeartTexture.loadFromFile("assets/hearts/hardcore_half.png")) {
-    throw AssetLoadException("assets/hearts/hardcore_half.png", "Texture");
-  }
-  if (!halfHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/hardcore_half_blinking.png")) {
-    throw AssetLoadException("assets/hearts/hardcore_half_blinking.png",
-                             "Texture");
-  }
+  halfHeartRegion = atlas.region("hearts/hardcore_half");
+  halfHeartBlinkingRegion = atlas.region("hearts/hardcore_half_blinking");
 
-  if (!poisonedFullHeartTexture.loadFromFile(
-          "assets/hearts/poisoned_hardcore_full.png")) {
-    throw AssetLoadException("assets/hearts/poisoned_hardcore_full.png",
-                             "Texture");
-  }
-  if (!poisonedFullHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/poisoned_hardcore_full_blinking.png")) {
-    throw AssetLoadException(
-        "assets/hearts/poisoned_hardcore_full_blinking.png", "Texture");
-  }
+  poisonedFullHeartRegion = atlas.region("hearts/poisoned_hardcore_full");
+  poisonedFullHeartBlinkingRegion =
+      atlas.region("hearts/poisoned_hardcore_full_blinking");
 
-  if (!poisonedHalfHeartTexture.loadFromFile(
-          "assets/hearts/poisoned_hardcore_half.png")) {
-    throw AssetLoadException("assets/hearts/poisoned_hardcore_half.png",
-                             "Texture");
-  }
-  if (!poisonedHalfHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/poisoned_hardcore_half_blinking.png")) {
-    throw AssetLoadException(
-        "assets/hearts/poisoned_hardcore_half_blinking.png", "Texture");
-  }
+  poisonedHalfHeartRegion = atlas.region("hearts/poisoned_hardcore_half");
+  poisonedHalfHeartBlinkingRegion =
+      atlas.region("hearts/poisoned_hardcore_half_blinking");
 
-  if (!witheredFullHeartTexture.loadFromFile(
-          "assets/hearts/withered_hardcore_full.png")) {
-    throw AssetLoadException("assets/hearts/withered_hardcore_full.png",
-                             "Texture");
-  }
-  if (!witheredFullHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/withered_hardcore_full_blinking.png")) {
-    throw AssetLoadException(
-        "assets/hearts/withered_hardcore_full_blinking.png", "Texture");
-  }
+  witheredFullHeartRegion = atlas.region("hearts/withered_hardcore_full");
+  witheredFullHeartBlinkingRegion =
+      atlas.region("hearts/withered_hardcore_full_blinking");
 
-  if (!witheredHalfHeartTexture.loadFromFile(
-          "assets/hearts/withered_hardcore_half.png")) {
-    throw AssetLoadException("assets/hearts/withered_hardcore_half.png",
-                             "Texture");
-  }
-  if (!witheredHalfHeartBlinkingTexture.loadFromFile(
-          "assets/hearts/withered_hardcore_half_blinking.png")) {
-    throw AssetLoadException(
-        "assets/hearts/withered_hardcore_half_blinking.png", "Texture");
-  }
+  witheredHalfHeartRegion = atlas.region("hearts/withered_hardcore_half");
+  witheredHalfHeartBlinkingRegion =
+      atlas.region("hearts/withered_hardcore_half_blinking");
 
-  containerSprite.emplace(containerTexture);
-  fullHeartSprite.emplace(fullHeartTexture);
-  halfHeartSprite.emplace(halfHeartTexture);
+  containerSprite.emplace(*containerRegion.page, containerRegion.rect);
+  fullHeartSprite.emplace(*fullHeartRegion.page, fullHeartRegion.rect);
+  halfHeartSprite.emplace(*halfHeartRegion.page, halfHeartRegion.rect);
 }
 
 
@@ -105,43 +61,72 @@ void HeartDisplay::triggerShake() {
     shakeTimer = SHAKE_DURATION;
 }
 
-void HeartDisplay::draw(sf::RenderWindow &window, int currentMistakes,
-                        int maxMistakes, const sf::Vector2f &position,
-                        float scale, bool isPoisoned, bool isWithered) {
-
-  bool useBlinking =
-      isFlashing && (static_cast<int>(flashTimer * 5.0f) % 2 == 0);
+void HeartDisplay::reset() {
+  isFlashing = false;
+  flashTimer = 0.0f;
+  shakeTimer = 0.0f;
+}
 
-  if (useBlinking) {
-    containerSprite->setTexture(containerBlinkingTexture);
-    if (isPoisoned) {
-      fullHeartSprite->setTexture(poisonedFullHeartBlinkingTexture);
-      halfHeartSprite->setTexture(poisonedHalfHeartBlinkingTexture);
-    } else if (isWithered) {
-      fullHeartSprite->setTexture(witheredFullHeartBlinkingTexture);
-      halfHeartSprite->setTexture(witheredHalfHeartBlinkingTexture);
+void HeartDisplay::applyRegions(bool blinking, bool poisoned, bool withered) {
+  if (blinking) {
+    containerBlinkingRegion.applyTo(*containerSprite);
+    if (poisoned) {
+      poisonedFullHeartBlinkingRegion.applyTo(*fullHeartSprite);
+      poisonedHalfHeartBlinkingRegion.applyTo(*halfHeartSprite);
+    } else if (withered) {
+      witheredFullHeartBlinkingRegion.applyTo(*fullHeartSprite);
+      witheredHalfHeartBlinkingRegion.applyTo(*halfHeartSprite);
     } else {
-      fullHeartSprite->setTexture(fullHeartBlinkingTexture);
-      halfHeartSprite->setTexture(halfHeartBlinkingTexture);
+      fullHeartBlinkingRegion.applyTo(*fullHeartSprite);
+      halfHeartBlinkingRegion.applyTo(*halfHeartSprite);
     }
   } else {
-    containerSprite->setTexture(containerTexture);
-    if (isPoisoned) {
-      fullHeartSprite->setTexture(poisonedFullHeartTexture);
-      halfHeartSprite->setTexture(poisonedHalfHeartTexture);
-    } else if (isWithered) {
-      fullHeartSprite->setTexture(witheredFullHeartTexture);
-      halfHeartSprite->setTexture(witheredHalfHeartTexture);
+    containerRegion.applyTo(*containerSprite);
+    if (poisoned) {
+      poisonedFullHeartRegion.applyTo(*fullHeartSprite);
+      poisonedHalfHeartRegion.applyTo(*halfHeartSprite);
+    } else if (withered) {
+      witheredFullHeartRegion.applyTo(*fullHeartSprite);
+      witheredHalfHeartRegion.applyTo(*halfHeartSprite);
     } else {
-      fullHeartSprite->setTexture(fullHeartTexture);
-      halfHeartSprite->setTexture(halfHeartTexture);
+      fullHeartRegion.applyTo(*fullHeartSprite);
+      halfHeartRegion.applyTo(*halfHeartSprite);
     }
   }
+}
+
+void HeartDisplay::repaintRow(const RowLook &look) {
+  int totalHearts = (look.maxHalfHearts + 1) / 2;
+  sf::RenderTarget &canvas =
+      row.begin(totalHearts, containerRegion.rect.size, 8, 2);
+
+  for (int strip = 0; strip < 2; ++strip) {
+    applyRegions(strip == 1, look.poisoned, look.withered);
+    for (int i = 0; i < totalHearts; ++i) {
+      sf::Vector2f at = row.slot(i, strip);
+      containerSprite->setPosition(at);
+      canvas.draw(*containerSprite);
+
+      // Full past the second half of this heart, half past the first
+      if (look.halfHearts > i * 2 + 1) {
+        fullHeartSprite->setPosition(at);
+        canvas.draw(*fullHeartSprite);
+      } else if (look.halfHearts > i * 2) {
+        halfHeartSprite->setPosition(at);
+        canvas.draw(*halfHeartSprite);
+      }
+    }
+  }
+  row.end();
+  rowLook = look;
+}
 
-  // Scale sprites
-  containerSprite->setScale({scale, scale});
-  fullHeartSprite->setScale({scale, scale});
-  halfHeartSprite->setScale({scale, scale});
+void HeartDisplay::draw(sf::RenderTarget &target, int currentMistakes,
+                        int maxMistakes, const sf::Vector2f &position,
+                        float scale, bool isPoisoned, bool isWithered) {
+
+  bool useBlinking =
+      isFlashing && (static_cast<int>(flashTimer * 5.0f) % 2 == 0);
 
   int totalHalfHearts = maxMistakes;
   int currentHalfHearts = std::max(0, maxMistakes - currentMistakes);
@@ -151,8 +136,10 @@ void HeartDisplay::draw(sf::RenderWindow &window, int currentMistakes,
     displayHalfHearts = std::min(totalHalfHearts, currentHalfHearts + 1);
   }
 
-  int totalHearts = (totalHalfHearts + 1) / 2;
-  float heartSpacing = 8.0f * scale;
+  const RowLook look{displayHalfHearts, totalHalfHearts, isPoisoned, isWithered};
+  if (look != rowLook) {
+    repaintRow(look);
+  }
 
   bool isLowHealth =
       (static_cast<float>(currentHalfHearts) / static_cast<float>(totalHalfHearts)) <= 0.2f ||
@@ -161,36 +148,13 @@ void HeartDisplay::draw(sf::RenderWindow &window, int currentMistakes,
   static std::mt19937 rng(std::random_device{}());
   std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
 
-  for (int i = 0; i < totalHearts; ++i) {
-    float x = position.x + static_cast<float>(i) * heartSpacing;
-    float y = position.y;
-
-    if (isLowHealth || shakeTimer > 0.0f) {
-      float shakeOffset = dist(rng) * scale;
-      if (shakeTimer > 0.0f) shakeOffset *= 1.5f;
-      y += shakeOffset;
-    }
-
-    containerSprite->setPosition({x, y});
-    window.draw(*containerSprite);
-
-    int heartValue = 0; // 0 = empty, 1 = half, 2 = full
-
-    int firstHalfIndex = i * 2;
-    int secondHalfIndex = i * 2 + 1;
-
-    if (displayHalfHearts > secondHalfIndex) {
-      heartValue = 2; // Full heart
-    } else if (displayHalfHearts > firstHalfIndex) {
-      heartValue = 1; // Half heart
-    }
-
-    if (heartValue == 2) {
-      fullHeartSprite->setPosition({x, y});
-      window.draw(*fullHeartSprite);
-    } else if (heartValue == 1) {
-      halfHeartSprite->setPosition({x, y});
-      window.draw(*halfHeartSprite);
+  shake.assign(static_cast<std::size_t>(row.getIconCount()), 0.0f);
+  if (isLowHealth || shakeTimer > 0.0f) {
+    for (float &offset : shake) {
+      offset = dist(rng) * scale;
+      if (shakeTimer > 0.0f) offset *= 1.5f;
     }
   }
+
+  row.draw(target, useBlinking ? 1 : 0, position, scale, shake);
 }
@@ -1,31 +1,50 @@
 #ifndef OOP_HEARTDISPLAY_H
 #define OOP_HEARTDISPLAY_H
 
+#include "IconRow.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 #include <optional>
+#include <vector>
 
 class HeartDisplay {
-  sf::Texture containerTexture;
-  sf::Texture containerBlinkingTexture;
-  sf::Texture fullHeartTexture;
-  sf::Texture fullHeartBlinkingTexture;
-  sf::Texture halfHeartTexture;
-  sf::Texture halfHeartBlinkingTexture;
-
-  sf::Texture poisonedFullHeartTexture;
-  sf::Texture poisonedFullHeartBlinkingTexture;
-  sf::Texture poisonedHalfHeartTexture;
-  sf::Texture poisonedHalfHeartBlinkingTexture;
+  AtlasRegion containerRegion;
+  AtlasRegion containerBlinkingRegion;
+  AtlasRegion fullHeartRegion;
+  AtlasRegion fullHeartBlinkingRegion;
+  AtlasRegion halfHeartRegion;
+  AtlasRegion halfHeartBlinkingRegion;
+
+  AtlasRegion poisonedFullHeartRegion;
+  AtlasRegion poisonedFullHeartBlinkingRegion;
+  AtlasRegion poisonedHalfHeartRegion;
+  AtlasRegion poisonedHalfHeartBlinkingRegion;
   
-  sf::Texture witheredFullHeartTexture;
-  sf::Texture witheredFullHeartBlinkingTexture;
-  sf::Texture witheredHalfHeartTexture;
-  sf::Texture witheredHalfHeartBlinkingTexture;
+  AtlasRegion witheredFullHeartRegion;
+  AtlasRegion witheredFullHeartBlinkingRegion;
+  AtlasRegion witheredHalfHeartRegion;
+  AtlasRegion witheredHalfHeartBlinkingRegion;
 
   std::optional<sf::Sprite> containerSprite;
   std::optional<sf::Sprite> fullHeartSprite;
   std::optional<sf::Sprite> halfHeartSprite;
 
+  // What the cached row shows; strip 0 is the normal look, strip 1 the
+  // blinking one.
+  struct RowLook {
+    int halfHearts;
+    int maxHalfHearts;
+    bool poisoned;
+    bool withered;
+    bool operator==(const RowLook &) const = default;
+  };
+  IconRow row;
+  std::optional<RowLook> rowLook;
+  std::vector<float> shake; // per heart, this frame
+
+  void applyRegions(bool blinking, bool poisoned, bool withered);
+  void repaintRow(const RowLook &look);
+
   bool isFlashing;
   float flashTimer;
   const float FLASH_DURATION = 1.0f;
@@ -39,8 +58,12 @@ public:
   void update(float deltaTime);
   void triggerFlash();
   void triggerShake();
-  void draw(sf::RenderWindow &window, int currentMistakes, int maxMistakes,
+  // Stops any flash or shake in progress.
+  void reset();
+  void draw(sf::RenderTarget &target, int currentMistakes, int maxMistakes,
             const sf::Vector2f &position, float scale, bool isPoisoned = false, bool isWithered = false);
+
+  [[nodiscard]] int getRedrawCount() const { return row.getRedrawCount(); }
 };
 
 #endif // OOP_HEARTDISPLAY_H
@@ -0,0 +1,133 @@
+#include "HintAssistant.h"
+#include "BitBoard.h"
+#include "Grid.h"
+#include "LineSolver.h"
+#include "PicrossHints.h"
+
+#include <bit>
+#include <vector>
+
+struct HintAssistant::Search {
+  std::uint64_t revision = 0;
+  PicrossHints hints;
+  BitBoard filled;
+  BitBoard empty;
+  std::atomic<bool> cancelled{false};
+  std::atomic<bool> done{false};
+  std::optional<MoveHint> result; // written by the worker before done is set
+};
+
+namespace {
+// Solves every unfinished line against the snapshot and returns a cell from
+// the line that decides the most new cells, which tends to be the step a
+// stuck player overlooked. Returns early, empty-handed, once cancelled.
+std::optional<MoveHint> findMove(const PicrossHints &hints,
+                                 const BitBoard &filled, const BitBoard &empty,
+                                 const std::atomic<bool> &cancelled) {
+  const int n = filled.size();
+  LineSolver solver;
+  std::optional<MoveHint> best;
+  int bestGain = 0;
+
+  for (int id = 0; id < 2 * n; ++id) {
+    if (cancelled.load(std::memory_order_relaxed))
+      return std::nullopt;
+    const bool isRow = id < n;
+    const int line = isRow ? id : id - n;
+    const BitLine cells = isRow ? filled.row(line) : filled.col(line);
+    const BitLine blanks = isRow ? empty.row(line) : empty.col(line);
+    if (cells.count() + blanks.count() == n)
+      continue;
+    if (!solver.solve_line(hints, filled, empty, isRow, line))
+      continue;
+
+    const auto fill = solver.forced_filled();
+    const auto blank = solver.forced_empty();
+    int gain = 0;
+    std::optional<MoveHint> first;
+    for (std::size_t w = 0; w < fill.size(); ++w) {
+      const std::uint64_t decided = cells.words()[w] | blanks.words()[w];
+      const std::uint64_t newFill = fill[w] & ~decided;
+      const std::uint64_t newBlank = blank[w] & ~decided;
+      gain += std::popcount(newFill) + std::popcount(newBlank);
+      if (!first && (newFill | newBlank)) {
+        const int k = static_cast<int>(w) * 64 +
+                      std::countr_zero(newFill | newBlank);
+        first = MoveHint{isRow ? line : k, isRow ? k : line,
+                         ((newFill >> (k & 63)) & 1u) != 0, isRow};
+      }
+    }
+    if (gain > bestGain) {
+      bestGain = gain;
+      best = first;
+    }
+  }
+  return best;
+}
+} // namespace
+
+HintAssistant::~HintAssistant() { cancel(); }
+
+void HintAssistant::request(const Grid &grid) {
+  const std::uint64_t revision = grid.get_revision();
+  visible = true;
+  if (cacheValid && cachedRevision == revision)
+    return;
+  if (pending && pending->revision == revision)
+    return;
+  if (pending)
+    pending->cancelled = true;
+
+  // Only marks that agree with the solution are taken as known
+  const BitBoard &solution = grid.get_solution();
+  const BitBoard &filled = grid.get_filled();
+  const BitBoard &crossed = grid.get_crossed();
+  const auto solutionWords = solution.row_words();
+  const auto filledWords = filled.row_words();
+  const auto crossedWords = crossed.row_words();
+  std::vector<std::uint64_t> knownFilled(solutionWords.size());
+  std::vector<std::uint64_t> knownEmpty(solutionWords.size());
+  for (std::size_t w = 0; w < solutionWords.size(); ++w) {
+    knownFilled[w] = filledWords[w] & solutionWords[w];
+    knownEmpty[w] = crossedWords[w] & ~solutionWords[w];
+  }
+
+  auto search = std::make_shared<Search>();
+  search->revision = revision;
+  search->hints = grid.get_hints();
+  search->filled = BitBoard(grid.get_size(), knownFilled);
+  search->empty = BitBoard(grid.get_size(), knownEmpty);
+  pending = search;
+
+  worker.submit([search] {
+    search->result = findMove(search->hints, search->filled, search->empty,
+                              search->cancelled);
+    search->done.store(true, std::memory_order_release);
+  });
+}
+
+void HintAssistant::cancel() {
+  if (pending)
+    pending->cancelled = true;
+  pending.reset();
+  visible = false;
+}
+
+std::optional<MoveHint> HintAssistant::poll(const Grid &grid) {
+  const std::uint64_t revision = grid.get_revision();
+  if (pending) {
+    if (pending->revision != revision) {
+      cancel();
+    } else if (pending->done.load(std::memory_order_acquire)) {
+      cached = pending->result;
+      cachedRevision = revision;
+      cacheValid = true;
+      pending.reset();
+    }
+  }
+  if (cacheValid && cachedRevision != revision)
+    visible = false;
+  if (visible && cacheValid && cachedRevision == revision)
+    return cached;
+  return std::nullopt;
+}
@@ -0,0 +1,59 @@
+#ifndef OOP_HINTASSISTANT_H
+#define OOP_HINTASSISTANT_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "ThreadPool.h"
+
+class Grid;
+
+// One cell the clues force, and the line whose clues prove it.
+struct MoveHint {
+  int row = 0;
+  int col = 0;
+  bool fill = false; // true: the cell must be filled, false: it must be empty
+  bool isRow = true; // the proving line is row `row` or column `col`
+};
+
+// Finds a "next logical move" for the player off the main thread. request()
+// snapshots the clues and the player's correct marks (wrong fills and
+// crosses are ignored, so a hint never builds on a mistake) and searches
+// the lines on a worker; poll() is called every frame and picks the result
+// up once it is ready. Results are cached by Grid::get_revision(), so asking
+// again without touching the board answers immediately, and any edit to the
+// board cancels a search still running for the old revision.
+class HintAssistant {
+  struct Search;
+
+  ThreadPool worker{1};
+  std::shared_ptr<Search> pending;
+  std::uint64_t cachedRevision = 0;
+  bool cacheValid = false;
+  std::optional<MoveHint> cached;
+  bool visible = false;
+
+public:
+  HintAssistant() = default;
+  ~HintAssistant();
+
+  HintAssistant(const HintAssistant &) = delete;
+  HintAssistant &operator=(const HintAssistant &) = delete;
+
+  // Starts a search for the grid's current state, unless one is running or
+  // cached for it already; the hint is shown once it is found.
+  void request(const Grid &grid);
+
+  // Drops any running search and hides the hint.
+  void cancel();
+
+  // Collects a finished search and returns the hint to show, if any. The
+  // hint disappears as soon as the board changes.
+  std::optional<MoveHint> poll(const Grid &grid);
+
+  [[nodiscard]] bool is_searching() const { return pending != nullptr; }
+};
+
+#endif // OOP_HINTASSISTANT_H
@@ -1,5 +1,5 @@
 #include "HungerDisplay.h"
-#include "Exceptions.h"
+#include "TextureAtlas.h"
 #include <random>
 #include <algorithm>
 
@@ -7,28 +7,17 @@ HungerDisplay::HungerDisplay()
     : isFlashing(false), flashTimer(0.0f),
       shakeTimer(0.0f), shakeIntervalTimer(0.0f),
       isShaking(false), hasHungerEffectState(false) {
-    if (!emptyTexture.loadFromFile("assets/hunger/food_empty.png")) {
-        throw AssetLoadException("assets/hunger/food_empty.png", "Texture");
-    }
-    if (!emptyHungerTexture.loadFromFile("assets/hunger/food_empty_hunger.png")) {
-        throw AssetLoadException("assets/hunger/food_empty_hunger.png", "Texture");
-    }
-    if (!fullTexture.loadFromFile("assets/hunger/food_full.png")) {
-        throw AssetLoadException("assets/hunger/food_full.png", "Texture");
-    }
-    if (!fullHungerTexture.loadFromFile("assets/hunger/food_full_hunger.png")) {
-        throw AssetLoadException("assets/hunger/food_full_hunger.png", "Texture");
-    }
-    if (!halfTexture.loadFromFile("assets/hunger/food_half.png")) {
-        throw AssetLoadException("assets/hunger/food_half.png", "Texture");
-    }
-    if (!halfHungerTexture.loadFromFile("assets/hunger/food_half_hunger.png")) {
-        throw AssetLoadException("assets/hunger/food_half_hunger.png", "Texture");
-    }
-
-    emptySprite.emplace(emptyTexture);
-    fullSprite.emplace(fullTexture);
-    halfSprite.emplace(halfTexture);
+    const TextureAtlas &atlas = TextureAtlas::game();
+    emptyRegion = atlas.region("hunger/food_empty");
+    emptyHungerRegion = atlas.region("hunger/food_empty_hunger");
+    fullRegion = atlas.region("hunger/food_full");
+    fullHungerRegion = atlas.region("hunger/food_full_hunger");
+    halfRegion = atlas.region("hunger/food_half");
+    halfHungerRegion = atlas.region("hunger/food_half_hunger");
+
+    emptySprite.emplace(*emptyRegion.page, emptyRegion.rect);
+    fullSprite.emplace(*fullRegion.page, fullRegion.rect);
+    halfSprite.emplace(*halfRegion.page, halfRegion.rect);
 }
 
 void HungerDisplay::update(float deltaTime, bool hasHungerEffect) {
@@ -70,71 +59,81 @@ void HungerDisplay::triggerFlash() {
     flashTimer = FLASH_DURATION;
 }
 
-void HungerDisplay::draw(sf::RenderWindow& window, int currentHunger, int maxHunger,
-                         const sf::Vector2f& position, float scale, bool hasHungerEffect) {
-    
-    bool useHungerTexture = hasHungerEffect && (static_cast<int>(flashTimer * 5.0f) % 2 == 0);
-    
-    if (useHungerTexture || hasHungerEffect) {
-        emptySprite->setTexture(emptyHungerTexture);
-        fullSprite->setTexture(fullHungerTexture);
-        halfSprite->setTexture(halfHungerTexture);
+void HungerDisplay::reset() {
+    isFlashing = false;
+    flashTimer = 0.0f;
+    shakeTimer = 0.0f;
+    shakeIntervalTimer = 0.0f;
+    isShaking = false;
+    hasHungerEffectState = false;
+}
+
+void HungerDisplay::repaintRow(const RowLook& look) {
+    if (look.hungerEffect) {
+        emptyHungerRegion.applyTo(*emptySprite);
+        fullHungerRegion.applyTo(*fullSprite);
+        halfHungerRegion.applyTo(*halfSprite);
     } else {
-        emptySprite->setTexture(emptyTexture);
-        fullSprite->setTexture(fullTexture);
-        halfSprite->setTexture(halfTexture);
+        emptyRegion.applyTo(*emptySprite);
+        fullRegion.applyTo(*fullSprite);
+        halfRegion.applyTo(*halfSprite);
+    }
+
+    int totalDrumsticks = (look.maxHalfDrumsticks + 1) / 2;
+    sf::RenderTarget& canvas = row.begin(totalDrumsticks, emptyRegion.rect.size, 8, 1);
+
+    // Drumstick 0 is the rightmost slot; later ones overlap it from the left
+    for (int i = 0; i < totalDrumsticks; ++i) {
+        sf::Vector2f at = row.slot(totalDrumsticks - 1 - i, 0);
+
+        // Draw empty container first
+        emptySprite->setPosition(at);
+        canvas.draw(*emptySprite);
+
+        int firstHalfIndex = i * 2;
+        int secondHalfIndex = i * 2 + 1;
+
+        if (look.halfDrumsticks > secondHalfIndex) {
+            fullSprite->setPosition(at);
+            canvas.draw(*fullSprite);
+        } else if (look.halfDrumsticks > firstHalfIndex) {
+            halfSprite->setPosition(at);
+            canvas.draw(*halfSprite);
+        }
     }
+    row.end();
+    rowLook = look;
+}
 
-    emptySprite->setScale({scale, scale});
-    fullSprite->setScale({scale, scale});
-    halfSprite->setScale({scale, scale});
+void HungerDisplay::draw(sf::RenderTarget& target, int currentHunger, int maxHunger,
+                         const sf::Vector2f& position, float scale, bool hasHungerEffect) {
 
     int totalHalfDrumsticks = maxHunger;
     int currentHalfDrumsticks = std::clamp(currentHunger, 0, totalHalfDrumsticks);
     int totalDrumsticks = (totalHalfDrumsticks + 1) / 2;
     float drumstickSpacing = 8.0f * scale;
 
+    const RowLook look{currentHalfDrumsticks, totalHalfDrumsticks, hasHungerEffect};
+    if (look != rowLook) {
+        repaintRow(look);
+    }
+
     bool isLowHunger = (static_cast<float>(currentHalfDrumsticks) / static_cast<float>(totalHalfDrumsticks)) <= 0.2f ||
                        currentHalfDrumsticks <= 1;
+    bool isZeroHungerShake = (currentHunger == 0);
 
     static std::mt19937 rng(std::random_device{}());
     std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
 
-    // Draw from RIGHT to LEFT
-    for (int i = 0; i < totalDrumsticks; ++i) {
-        // Position from right: (totalDrumsticks - 1 - i) places it at right side
-        float x = position.x - static_cast<float>(i + 1) * drumstickSpacing;
-        float y = position.y;
-
-        bool isZeroHungerShake = (currentHunger == 0);
-        
-        if ((isLowHunger || isShaking || isZeroHungerShake) && (hasHungerEffect || isZeroHungerShake)) {
-            float shakeOffset = dist(rng) * scale;
-            y += shakeOffset;
-        }
-
-        // Draw empty container first
-        emptySprite->setPosition({x, y});
-        window.draw(*emptySprite);
-
-        
-        int drumstickIndex = i;
-        int firstHalfIndex = drumstickIndex * 2;
-        int secondHalfIndex = drumstickIndex * 2 + 1;
-
-        int drumstickValue = 0;
-        if (currentHalfDrumsticks > secondHalfIndex) {
-            drumstickValue = 2; // Full
-        } else if (currentHalfDrumsticks > firstHalfIndex) {
-            drumstickValue = 1; // Half
-        }
-
-        if (drumstickValue == 2) {
-            fullSprite->setPosition({x, y});
-            window.draw(*fullSprite);
-        } else if (drumstickValue == 1) {
-            halfSprite->setPosition({x, y});
-            window.draw(*halfSprite);
+    shake.assign(static_cast<std::size_t>(totalDrumsticks), 0.0f);
+    if ((isLowHunger || isShaking || isZeroHungerShake) && (hasHungerEffect || isZeroHungerShake)) {
+        for (float& offset : shake) {
+            offset = dist(rng) * scale;
         }
     }
+
+    // The row ends at position, growing leftwards
+    sf::Vector2f rowStart = {position.x - static_cast<float>(totalDrumsticks) * drumstickSpacing,
+                             position.y};
+    row.draw(target, 0, rowStart, scale, shake);
 }
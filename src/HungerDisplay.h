@@ -1,21 +1,37 @@
 #ifndef HUNGER_DISPLAY_H
 #define HUNGER_DISPLAY_H
 
+#include "IconRow.h"
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 #include <optional>
+#include <vector>
 
 class HungerDisplay {
-    sf::Texture emptyTexture;
-    sf::Texture emptyHungerTexture;
-    sf::Texture fullTexture;
-    sf::Texture fullHungerTexture;
-    sf::Texture halfTexture;
-    sf::Texture halfHungerTexture;
+    AtlasRegion emptyRegion;
+    AtlasRegion emptyHungerRegion;
+    AtlasRegion fullRegion;
+    AtlasRegion fullHungerRegion;
+    AtlasRegion halfRegion;
+    AtlasRegion halfHungerRegion;
 
     std::optional<sf::Sprite> emptySprite;
     std::optional<sf::Sprite> fullSprite;
     std::optional<sf::Sprite> halfSprite;
 
+    // What the cached row shows, painted right to left like the HUD
+    struct RowLook {
+        int halfDrumsticks;
+        int maxHalfDrumsticks;
+        bool hungerEffect;
+        bool operator==(const RowLook&) const = default;
+    };
+    IconRow row;
+    std::optional<RowLook> rowLook;
+    std::vector<float> shake; // per drumstick, this frame
+
+    void repaintRow(const RowLook& look);
+
     bool isFlashing;
     float flashTimer;
     const float FLASH_DURATION = 1.0f;
@@ -31,11 +47,15 @@ public:
 
     void update(float deltaTime, bool hasHungerEffect); // Updated signature
     void triggerFlash();
+    // Stops any flash or shake in progress.
+    void reset();
     
     // Draw hunger from RIGHT to LEFT (opposite of hearts)
     // currentHunger: 0-20 (half drumsticks), maxHunger: typically 20
-    void draw(sf::RenderWindow& window, int currentHunger, int maxHunger,
+    void draw(sf::RenderTarget& target, int currentHunger, int maxHunger,
               const sf::Vector2f& position, float scale, bool hasHungerEffect = false);
+
+    [[nodiscard]] int getRedrawCount() const { return row.getRedrawCount(); }
 };
 
 #endif // HUNGER_DISPLAY_H
@@ -0,0 +1,52 @@
+#include "IconRow.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+
+sf::RenderTarget &IconRow::begin(int icons, sf::Vector2i icon, int iconSpacing,
+                                 int strips) {
+  count = std::max(icons, 0);
+  iconSize = icon;
+  spacing = iconSpacing;
+  const sf::Vector2u size = {
+      static_cast<unsigned>(std::max(1, (count - 1) * spacing + iconSize.x)),
+      static_cast<unsigned>(std::max(1, iconSize.y * strips))};
+  if (size != textureSize) {
+    if (!texture.resize(size)) {
+      throw AssetLoadException("HUD icon row", "Render Texture");
+    }
+    textureSize = size;
+  }
+  texture.clear(sf::Color::Transparent);
+  ++redraws;
+  return texture;
+}
+
+sf::Vector2f IconRow::slot(int index, int strip) const {
+  return {static_cast<float>(index * spacing),
+          static_cast<float>(strip * iconSize.y)};
+}
+
+void IconRow::end() { texture.display(); }
+
+void IconRow::draw(sf::RenderTarget &target, int strip, sf::Vector2f position,
+                   float scale, std::span<const float> offsetY) {
+  quads.resize(static_cast<std::size_t>(count) * 6);
+  const sf::Vector2f extent = sf::Vector2f(iconSize) * scale;
+  for (int i = 0; i < count; ++i) {
+    const sf::Vector2f uv1 = slot(i, strip);
+    const sf::Vector2f uv2 = uv1 + sf::Vector2f(iconSize);
+    const float lift = static_cast<std::size_t>(i) < offsetY.size() ? offsetY[i] : 0.f;
+    const sf::Vector2f p1 = position + sf::Vector2f{uv1.x * scale, lift};
+    const sf::Vector2f p2 = p1 + extent;
+
+    sf::Vertex *quad = &quads[static_cast<std::size_t>(i) * 6];
+    quad[0] = {p1, sf::Color::White, uv1};
+    quad[1] = {{p2.x, p1.y}, sf::Color::White, {uv2.x, uv1.y}};
+    quad[2] = {{p1.x, p2.y}, sf::Color::White, {uv1.x, uv2.y}};
+    quad[3] = quad[2];
+    quad[4] = quad[1];
+    quad[5] = {p2, sf::Color::White, uv2};
+  }
+  target.draw(quads, &texture.getTexture());
+}
@@ -0,0 +1,45 @@
+#ifndef OOP_ICONROW_H
+#define OOP_ICONROW_H
+
+#include <SFML/Graphics.hpp>
+#include <span>
+
+// A row of overlapping HUD icons (hearts, drumsticks) painted once, one
+// texel per pixel, into a small texture with one strip per look (say,
+// normal and blinking). Each frame the row goes to the window as one quad
+// per icon, so choosing a strip or shaking single icons only touches
+// vertices; the icons are repainted only when what they show changes.
+class IconRow {
+  sf::RenderTexture texture;
+  sf::Vector2u textureSize;
+  sf::Vector2i iconSize;
+  int spacing = 0;
+  int count = 0;
+  sf::VertexArray quads{sf::PrimitiveType::Triangles};
+  int redraws = 0;
+
+public:
+  // Sizes the texture for count icons, spacing texels apart, on the given
+  // number of strips and clears it for painting. Throws AssetLoadException
+  // if the texture cannot be created.
+  sf::RenderTarget &begin(int icons, sf::Vector2i icon, int iconSpacing,
+                          int strips);
+
+  // Where to paint icon index of a strip in begin()'s target.
+  [[nodiscard]] sf::Vector2f slot(int index, int strip) const;
+
+  // Finishes painting.
+  void end();
+
+  // Draws one strip with icon 0's top-left at position, scaled, each icon
+  // lifted by its entry in offsetY (window pixels, may be empty).
+  void draw(sf::RenderTarget &target, int strip, sf::Vector2f position,
+            float scale, std::span<const float> offsetY);
+
+  [[nodiscard]] int getIconCount() const { return count; }
+
+  // Times the row was repainted.
+  [[nodiscard]] int getRedrawCount() const { return redraws; }
+};
+
+#endif // OOP_ICONROW_H
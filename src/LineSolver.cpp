@@ -0,0 +1,390 @@
+#include "LineSolver.h"
+#include "BitKernels.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace {
+std::uint64_t reverse_bits(std::uint64_t x) {
+  x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+  x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+  x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+  x = ((x >> 16) & 0x0000FFFF0000FFFFULL) |
+      ((x & 0x0000FFFF0000FFFFULL) << 16);
+  return (x >> 32) | (x << 32);
+}
+
+// Fixed-width bit string of W words, just enough arithmetic for the sweeps.
+// With W == 1 every operation folds down to a single machine instruction.
+template <int W> struct Wide {
+  std::array<std::uint64_t, W> w{};
+
+  static Wide low_mask(int n) {
+    Wide r;
+    for (int i = 0; i < W; ++i) {
+      const int bits = std::clamp(n - 64 * i, 0, 64);
+      r.w[i] = bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+    }
+    return r;
+  }
+
+  static Wide load(std::span<const std::uint64_t> words) {
+    Wide r;
+    for (int i = 0; i < W && i < static_cast<int>(words.size()); ++i)
+      r.w[i] = words[i];
+    return r;
+  }
+
+  [[nodiscard]] bool any() const {
+    std::uint64_t acc = 0;
+    for (std::uint64_t x : w)
+      acc |= x;
+    return acc != 0;
+  }
+
+  friend Wide operator&(Wide a, const Wide &b) {
+    for (int i = 0; i < W; ++i)
+      a.w[i] &= b.w[i];
+    return a;
+  }
+
+  friend Wide operator|(Wide a, const Wide &b) {
+    for (int i = 0; i < W; ++i)
+      a.w[i] |= b.w[i];
+    return a;
+  }
+
+  friend Wide operator^(Wide a, const Wide &b) {
+    for (int i = 0; i < W; ++i)
+      a.w[i] ^= b.w[i];
+    return a;
+  }
+
+  friend Wide operator~(Wide a) {
+    for (std::uint64_t &x : a.w)
+      x = ~x;
+    return a;
+  }
+
+  friend Wide operator+(const Wide &a, const Wide &b) {
+    Wide r;
+    std::uint64_t carry = 0;
+    for (int i = 0; i < W; ++i) {
+      const std::uint64_t s = a.w[i] + b.w[i];
+      r.w[i] = s + carry;
+      carry = (s < a.w[i]) | (r.w[i] < s);
+    }
+    return r;
+  }
+
+  // Shifts towards higher bit positions; bits shifted past the end are lost.
+  [[nodiscard]] Wide shl(int k) const {
+    Wide r;
+    const int q = k >> 6;
+    const int b = k & 63;
+    for (int i = W - 1; i >= q; --i) {
+      r.w[i] = w[i - q] << b;
+      if (b != 0 && i - q - 1 >= 0)
+        r.w[i] |= w[i - q - 1] >> (64 - b);
+    }
+    return r;
+  }
+
+  [[nodiscard]] Wide shr(int k) const {
+    Wide r;
+    const int q = k >> 6;
+    const int b = k & 63;
+    for (int i = 0; i + q < W; ++i) {
+      r.w[i] = w[i + q] >> b;
+      if (b != 0 && i + q + 1 < W)
+        r.w[i] |= w[i + q + 1] << (64 - b);
+    }
+    return r;
+  }
+
+  // Bit k <-> bit n - 1 - k over the first n bits.
+  [[nodiscard]] Wide mirror(int n) const {
+    Wide r;
+    for (int i = 0; i < W; ++i)
+      r.w[i] = reverse_bits(w[W - 1 - i]);
+    return r.shr(64 * W - n);
+  }
+};
+
+// Adds every position reachable from `from` by stepping over cells that may
+// be empty. The carry of (from + canEmpty) runs through each stretch of
+// such cells in one addition.
+template <int W>
+Wide<W> extend_gaps(const Wide<W> &from, const Wide<W> &canEmpty) {
+  return from | (((from & canEmpty) + canEmpty) ^ canEmpty);
+}
+
+// Positions s where cells [s, s + len) are all set.
+template <int W> Wide<W> runs_of(Wide<W> cells, int len) {
+  for (int have = 1; have < len;) {
+    const int step = std::min(have, len - have);
+    cells = cells & cells.shr(step);
+    have += step;
+  }
+  return cells;
+}
+
+// Cells covered by a block of length len starting at any position in starts.
+template <int W> Wide<W> smear(Wide<W> starts, int len) {
+  for (int have = 1; have < len;) {
+    const int step = std::min(have, len - have);
+    starts = starts | starts.shl(step);
+    have += step;
+  }
+  return starts;
+}
+
+// Left-to-right sweep. prefix[i] holds positions p where cells [0, p) can
+// hold exactly blocks 0..i-1; starts[i] the positions where block i can
+// begin given everything before it. With reversed set, the clues are taken
+// from the end, which is the same sweep over the mirrored line.
+template <int W>
+void sweep(std::span<const std::uint16_t> clues, bool reversed,
+           const Wide<W> &canFill, const Wide<W> &canEmpty, Wide<W> *prefix,
+           Wide<W> *starts) {
+  const int k = static_cast<int>(clues.size());
+  Wide<W> origin;
+  origin.w[0] = 1;
+  Wide<W> gap = extend_gaps(origin, canEmpty); // positions after a gap
+  Wide<W> ends;                                // positions right after a block
+  for (int i = 0; i < k; ++i) {
+    const int len = clues[reversed ? k - 1 - i : i];
+    prefix[i] = ends | gap;
+    starts[i] = gap & runs_of(canFill, len);
+    ends = starts[i].shl(len);
+    gap = extend_gaps((ends & canEmpty).shl(1), canEmpty);
+  }
+  prefix[k] = ends | gap;
+}
+
+bool is_blank_line(std::span<const std::uint16_t> clues) {
+  return clues.empty() || (clues.size() == 1 && clues[0] == 0);
+}
+
+// Line of up to 64 * W cells.
+template <int W>
+bool solve_wide(std::span<const std::uint16_t> clues, int length,
+                const Wide<W> &knownFilled, const Wide<W> &knownEmpty,
+                Wide<W> &outFilled, Wide<W> &outEmpty) {
+  // 64 cells hold at most 32 blocks (one gap between each pair)
+  constexpr int kMaxBlocks = 32 * W;
+  const Wide<W> line = Wide<W>::low_mask(length);
+  outFilled = Wide<W>{};
+  outEmpty = Wide<W>{};
+
+  if (is_blank_line(clues)) {
+    if (knownFilled.any())
+      return false;
+    outEmpty = line;
+    return true;
+  }
+  if (clues.size() > kMaxBlocks)
+    return false;
+
+  const int k = static_cast<int>(clues.size());
+  const Wide<W> canFill = line & ~knownEmpty;
+  const Wide<W> canEmpty = line & ~knownFilled;
+
+  std::array<Wide<W>, kMaxBlocks + 1> prefix;
+  std::array<Wide<W>, kMaxBlocks + 1> suffix;
+  std::array<Wide<W>, kMaxBlocks> starts;
+  std::array<Wide<W>, kMaxBlocks> tailStarts;
+  sweep<W>(clues, false, canFill, canEmpty, prefix.data(), starts.data());
+  sweep<W>(clues, true, canFill.mirror(length), canEmpty.mirror(length),
+           suffix.data(), tailStarts.data());
+
+  // A block may sit at s when both sweeps allow it: the mirrored start of
+  // the same block is its last cell, hence the shift back by len - 1.
+  Wide<W> fillable;
+  for (int i = 0; i < k; ++i) {
+    const int len = clues[i];
+    const Wide<W> placed =
+        starts[i] & tailStarts[k - 1 - i].mirror(length).shr(len - 1);
+    if (!placed.any())
+      return false;
+    fillable = fillable | smear(placed, len);
+  }
+
+  // A cell may be empty when it can sit between blocks i-1 and i.
+  Wide<W> blankable;
+  for (int i = 0; i <= k; ++i)
+    blankable = blankable | (prefix[i] & suffix[k - i].mirror(length));
+  blankable = blankable & canEmpty;
+
+  outFilled = line & ~blankable;
+  outEmpty = line & ~fillable;
+  return true;
+}
+
+template <int W>
+bool solve_into(std::span<const std::uint16_t> clues, int length,
+                std::span<const std::uint64_t> knownFilled,
+                std::span<const std::uint64_t> knownEmpty,
+                std::vector<std::uint64_t> &outFilled,
+                std::vector<std::uint64_t> &outEmpty) {
+  Wide<W> filled;
+  Wide<W> empty;
+  const bool ok = solve_wide<W>(clues, length, Wide<W>::load(knownFilled),
+                                Wide<W>::load(knownEmpty), filled, empty);
+  const int words = BitKernels::line_words(length);
+  outFilled.assign(filled.w.begin(), filled.w.begin() + words);
+  outEmpty.assign(empty.w.begin(), empty.w.begin() + words);
+  return ok;
+}
+} // namespace
+
+bool LineSolver::solve_word(std::span<const std::uint16_t> clues, int length,
+                            std::uint64_t known_filled,
+                            std::uint64_t known_empty,
+                            std::uint64_t &out_filled,
+                            std::uint64_t &out_empty) {
+  Wide<1> filled;
+  Wide<1> empty;
+  const bool ok = solve_wide<1>(clues, length, Wide<1>{{known_filled}},
+                                Wide<1>{{known_empty}}, filled, empty);
+  out_filled = filled.w[0];
+  out_empty = empty.w[0];
+  return ok;
+}
+
+bool LineSolver::solve_general(std::span<const std::uint16_t> clues,
+                               int length,
+                               std::span<const std::uint64_t> known_filled,
+                               std::span<const std::uint64_t> known_empty) {
+  const int n = length;
+  const int words = BitKernels::line_words(n);
+  forced_fill.assign(words, 0);
+  forced_blank.assign(words, 0);
+
+  const std::span<const std::uint16_t> blocks =
+      is_blank_line(clues) ? std::span<const std::uint16_t>{} : clues;
+  const int k = static_cast<int>(blocks.size());
+  const auto bit = [](std::span<const std::uint64_t> w, int c) {
+    return ((w[static_cast<std::size_t>(c) >> 6] >> (c & 63)) & 1u) != 0;
+  };
+  const auto canEmpty = [&](int c) { return !bit(known_filled, c); };
+
+  // cover[0..n]: known-empty prefix counts, cover[n+1..]: placement deltas
+  cover.assign(2 * static_cast<std::size_t>(n + 1), 0);
+  int *blanks = cover.data();
+  int *delta = cover.data() + n + 1;
+  for (int c = 0; c < n; ++c)
+    blanks[c + 1] = blanks[c] + (bit(known_empty, c) ? 1 : 0);
+  const auto fits = [&](int s, int len) {
+    return s + len <= n && blanks[s + len] == blanks[s];
+  };
+
+  // before[i][p]: cells [0, p) can hold exactly blocks 0..i-1.
+  // after[i][p]: cells [p, n) can hold exactly blocks i..k-1.
+  const std::size_t stride = static_cast<std::size_t>(n) + 1;
+  before.assign((k + 1) * stride, 0);
+  after.assign((k + 1) * stride, 0);
+  const auto at = [stride](std::vector<std::uint8_t> &t, int i, int p) -> std::uint8_t & {
+    return t[i * stride + p];
+  };
+
+  at(before, 0, 0) = 1;
+  for (int p = 1; p <= n; ++p) {
+    for (int i = 0; i <= k; ++i) {
+      bool ok = canEmpty(p - 1) && at(before, i, p - 1);
+      if (!ok && i > 0) {
+        const int len = blocks[i - 1];
+        const int s = p - len;
+        ok = s >= 0 && fits(s, len) &&
+             (s == 0 ? i == 1 : canEmpty(s - 1) && at(before, i - 1, s - 1));
+      }
+      at(before, i, p) = ok;
+    }
+  }
+
+  at(after, k, n) = 1;
+  for (int p = n - 1; p >= 0; --p) {
+    for (int i = k; i >= 0; --i) {
+      bool ok = canEmpty(p) && at(after, i, p + 1);
+      if (!ok && i < k) {
+        const int len = blocks[i];
+        const int e = p + len;
+        ok = fits(p, len) &&
+             (e == n ? i == k - 1 : canEmpty(e) && at(after, i + 1, e + 1));
+      }
+      at(after, i, p) = ok;
+    }
+  }
+
+  first_start.assign(k, n);
+  last_start.assign(k, -1);
+  if (!at(before, k, n))
+    return false;
+
+  for (int i = 0; i < k; ++i) {
+    const int len = blocks[i];
+    for (int s = 0; s + len <= n; ++s) {
+      const int e = s + len;
+      if (fits(s, len) &&
+          (s == 0 ? i == 0 : canEmpty(s - 1) && at(before, i, s - 1)) &&
+          (e == n ? i == k - 1 : canEmpty(e) && at(after, i + 1, e + 1))) {
+        ++delta[s];
+        --delta[e];
+        first_start[i] = std::min(first_start[i], s);
+        last_start[i] = s;
+      }
+    }
+  }
+
+  int covered = 0;
+  for (int c = 0; c < n; ++c) {
+    covered += delta[c];
+    bool blankable = false;
+    if (canEmpty(c)) {
+      for (int i = 0; i <= k && !blankable; ++i)
+        blankable = at(before, i, c) && at(after, i, c + 1);
+    }
+    const std::uint64_t mask = std::uint64_t{1} << (c & 63);
+    if (!blankable)
+      forced_fill[c >> 6] |= mask;
+    if (covered == 0)
+      forced_blank[c >> 6] |= mask;
+  }
+  return true;
+}
+
+bool LineSolver::solve(std::span<const std::uint16_t> clues, int length,
+                       std::span<const std::uint64_t> known_filled,
+                       std::span<const std::uint64_t> known_empty) {
+  if (length > 0 && length <= 64) {
+    forced_fill.assign(1, 0);
+    forced_blank.assign(1, 0);
+    return solve_word(clues, length, known_filled[0], known_empty[0],
+                      forced_fill[0], forced_blank[0]);
+  }
+  if (length > 64 && length <= 128) {
+    return solve_into<2>(clues, length, known_filled, known_empty,
+                         forced_fill, forced_blank);
+  }
+  if (length > 128 && length <= 256) {
+    return solve_into<4>(clues, length, known_filled, known_empty,
+                         forced_fill, forced_blank);
+  }
+  return solve_general(clues, length, known_filled, known_empty);
+}
+
+bool LineSolver::solve_line(const PicrossHints &hints, const BitBoard &filled,
+                            const BitBoard &crossed, bool isRow, int line) {
+  const int count = isRow ? hints.get_row_count() : hints.get_col_count();
+  if (line < 0 || line >= count || line >= filled.size()) {
+    throw OutOfBoundsException("Line index " + std::to_string(line) +
+                               " out of range");
+  }
+  const BitLine cells = isRow ? filled.row(line) : filled.col(line);
+  const BitLine blanks = isRow ? crossed.row(line) : crossed.col(line);
+  return solve(isRow ? hints.get_row(line) : hints.get_col(line),
+               cells.size(), cells.words(), blanks.words());
+}
@@ -0,0 +1,76 @@
+#ifndef OOP_LINESOLVER_H
+#define OOP_LINESOLVER_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitBoard.h"
+#include "PicrossHints.h"
+
+// Exact single-line nonogram deduction. Given a line's clues and the cells
+// already known to be filled or empty, finds the cells that take the same
+// value in every placement of the clues, i.e. the cells forced filled and
+// forced empty. Masks use the BitLine layout (bit k of word k / 64).
+//
+// Lines of up to 256 cells are solved as a handful of shift/add sweeps over
+// one bit string per clue (one word wide up to 64 cells, then 2 or 4): a
+// left-to-right pass finds where each block can start given the cells
+// before it, the same pass over the reversed line does the cells after it,
+// and intersecting the two gives every legal placement. Longer lines fall
+// back to the equivalent table-driven sweep.
+class LineSolver {
+  std::vector<std::uint64_t> forced_fill;
+  std::vector<std::uint64_t> forced_blank;
+
+  // Scratch for the general path, reused across calls
+  std::vector<std::uint8_t> before;
+  std::vector<std::uint8_t> after;
+  std::vector<int> cover;
+  std::vector<int> first_start;
+  std::vector<int> last_start;
+
+public:
+  // Solves one line of the given length. known_filled/known_empty must hold
+  // line_words(length) words with no bits past the end of the line.
+  // Returns false if no placement of the clues agrees with the known cells;
+  // the forced masks are then left cleared.
+  bool solve(std::span<const std::uint16_t> clues, int length,
+             std::span<const std::uint64_t> known_filled,
+             std::span<const std::uint64_t> known_empty);
+
+  // Solves row or column `line` of a board, taking crossed cells as known
+  // empty (Grid::get_filled() / Grid::get_crossed()).
+  bool solve_line(const PicrossHints &hints, const BitBoard &filled,
+                  const BitBoard &crossed, bool isRow, int line);
+
+  // Table-driven path used for lines longer than 256 cells. Exposed so the
+  // bit-parallel paths can be checked against it.
+  bool solve_general(std::span<const std::uint16_t> clues, int length,
+                     std::span<const std::uint64_t> known_filled,
+                     std::span<const std::uint64_t> known_empty);
+
+  // Single-word path; length must be in [1, 64].
+  static bool solve_word(std::span<const std::uint16_t> clues, int length,
+                         std::uint64_t known_filled, std::uint64_t known_empty,
+                         std::uint64_t &out_filled, std::uint64_t &out_empty);
+
+  // Leftmost and rightmost legal start of each block, filled in by the
+  // last solve_general() call that found the line consistent.
+  [[nodiscard]] std::span<const int> first_starts() const {
+    return first_start;
+  }
+
+  [[nodiscard]] std::span<const int> last_starts() const { return last_start; }
+
+  // Results of the last call, including the cells that were already known.
+  [[nodiscard]] std::span<const std::uint64_t> forced_filled() const {
+    return forced_fill;
+  }
+
+  [[nodiscard]] std::span<const std::uint64_t> forced_empty() const {
+    return forced_blank;
+  }
+};
+
+#endif // OOP_LINESOLVER_H
@@ -0,0 +1,92 @@
+#include "LineTracker.h"
+#include "BitKernels.h"
+
+#include <algorithm>
+
+LineTracker::LineTracker(const PicrossHints &hints, const BitBoard &cells)
+    : rows{hints.get_row_count()} {
+  const int lines = rows + hints.get_col_count();
+  line_done.assign(lines, 0);
+  line_dirty.assign(lines, 0);
+  clue_offset.reserve(static_cast<size_t>(lines) + 1);
+
+  std::uint32_t offset = 0;
+  for (int i = 0; i < rows; ++i) {
+    clue_offset.push_back(offset);
+    offset += static_cast<std::uint32_t>(hints.get_row(i).size());
+  }
+  for (int j = 0; j < hints.get_col_count(); ++j) {
+    clue_offset.push_back(offset);
+    offset += static_cast<std::uint32_t>(hints.get_col(j).size());
+  }
+  clue_offset.push_back(offset);
+  clue_done.assign(offset, 0);
+
+  for (int i = 0; i < rows && i < cells.size(); ++i) {
+    update(true, i, cells.row(i), hints.get_row(i));
+  }
+  for (int j = 0; j < hints.get_col_count() && j < cells.size(); ++j) {
+    update(false, j, cells.col(j), hints.get_col(j));
+  }
+  clear_dirty();
+}
+
+void LineTracker::update(bool isRow, int line, const BitLine &cells,
+                         std::span<const std::uint16_t> clues) {
+  const int id = line_id(isRow, line);
+  runs.clear();
+  BitKernels::extract_runs(cells.words(), runs);
+
+  bool changed = false;
+  std::uint8_t *flags = clue_done.data() + clue_offset[id];
+  auto setClue = [&](size_t k, bool value) {
+    if (flags[k] != static_cast<std::uint8_t>(value)) {
+      flags[k] = value;
+      changed = true;
+    }
+  };
+
+  bool done;
+  const size_t clueCount = clues.size();
+  if (clueCount == 1 && clues[0] == 0) {
+    // A "0" line is satisfied only while it stays empty
+    done = runs.empty();
+    setClue(0, done);
+  } else {
+    done = std::ranges::equal(runs, clues);
+
+    // Partial credit: runs that already match clues from either end of the
+    // line, as long as the line does not hold more runs than clues.
+    size_t prefix = 0;
+    size_t suffix = 0;
+    if (!done && runs.size() <= clueCount) {
+      while (prefix < runs.size() &&
+             runs[prefix] == static_cast<int>(clues[prefix]))
+        ++prefix;
+      while (suffix < runs.size() - prefix &&
+             runs[runs.size() - 1 - suffix] ==
+                 static_cast<int>(clues[clueCount - 1 - suffix]))
+        ++suffix;
+    }
+    for (size_t k = 0; k < clueCount; ++k) {
+      setClue(k, done || k < prefix || k >= clueCount - suffix);
+    }
+  }
+
+  if (line_done[id] != static_cast<std::uint8_t>(done)) {
+    line_done[id] = done;
+    satisfied += done ? 1 : -1;
+    changed = true;
+  }
+
+  if (changed && !line_dirty[id]) {
+    line_dirty[id] = 1;
+    dirty_lines.push_back(id);
+  }
+}
+
+void LineTracker::clear_dirty() {
+  for (int id : dirty_lines)
+    line_dirty[id] = 0;
+  dirty_lines.clear();
+}
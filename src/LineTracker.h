@@ -0,0 +1,57 @@
+#ifndef OOP_LINETRACKER_H
+#define OOP_LINETRACKER_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitBoard.h"
+#include "PicrossHints.h"
+
+// Incremental record of which rows/columns (and which individual clues)
+// currently match the player's cells. Grid re-evaluates only the row and
+// column of a toggled cell, so updates cost O(n / 64 + runs) and queries
+// are O(1). Lines are numbered rows first (0..n-1), then columns (n..2n-1).
+class LineTracker {
+  int rows = 0;
+  std::vector<std::uint8_t> line_done;    // per line
+  std::vector<std::uint32_t> clue_offset; // per line, into clue_done
+  std::vector<std::uint8_t> clue_done;    // per clue, same order as hints
+  std::vector<std::uint8_t> line_dirty;   // per line, dedupes dirty_lines
+  std::vector<int> dirty_lines;
+  std::vector<int> runs;                  // scratch for run extraction
+  int satisfied = 0;
+
+  [[nodiscard]] int line_id(bool isRow, int line) const {
+    return isRow ? line : rows + line;
+  }
+
+public:
+  LineTracker() = default;
+
+  // Evaluates every line of the board against the hints.
+  LineTracker(const PicrossHints &hints, const BitBoard &cells);
+
+  // Re-evaluates one line after a cell on it changed.
+  void update(bool isRow, int line, const BitLine &cells,
+              std::span<const std::uint16_t> clues);
+
+  [[nodiscard]] bool is_line_satisfied(bool isRow, int line) const {
+    return line_done[line_id(isRow, line)] != 0;
+  }
+
+  [[nodiscard]] bool is_clue_satisfied(bool isRow, int line, int index) const {
+    return clue_done[clue_offset[line_id(isRow, line)] + index] != 0;
+  }
+
+  [[nodiscard]] int satisfied_lines() const { return satisfied; }
+
+  // Lines whose state changed since the last clear_dirty(), in line numbers.
+  [[nodiscard]] std::span<const int> get_dirty_lines() const {
+    return dirty_lines;
+  }
+
+  void clear_dirty();
+};
+
+#endif // OOP_LINETRACKER_H
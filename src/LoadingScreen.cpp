@@ -0,0 +1,54 @@
+#include "LoadingScreen.h"
+#include "ResourceCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+LoadingScreen::LoadingScreen(const sf::String &title)
+    : font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      titleText(*font, title, 40), progressText(*font, "", 20) {
+  barOutline.setFillColor(sf::Color::Transparent);
+  barOutline.setOutlineColor(sf::Color::White);
+  barFill.setFillColor(sf::Color(128, 255, 128));
+}
+
+void LoadingScreen::draw(sf::RenderWindow &window, std::size_t done,
+                         std::size_t total) {
+  const sf::Vector2f size(window.getSize());
+  const float scale = std::min(size.x / 1280.0f, size.y / 720.0f);
+  const float fraction =
+      total == 0 ? 1.f
+                 : static_cast<float>(done) / static_cast<float>(total);
+
+  window.clear(sf::Color(36, 36, 36));
+  window.setView(window.getDefaultView());
+
+  titleText.setScale({scale, scale});
+  titleText.setShadowScale(scale);
+  const sf::FloatRect titleBounds = titleText.getLocalBounds();
+  titleText.setOrigin({titleBounds.position.x + titleBounds.size.x / 2.f,
+                       titleBounds.position.y + titleBounds.size.y / 2.f});
+  titleText.setPosition({size.x / 2.f, size.y / 2.f - 60.f * scale});
+  window.draw(titleText);
+
+  const sf::Vector2f barSize(400.f * scale, 12.f * scale);
+  const sf::Vector2f barPosition((size.x - barSize.x) / 2.f, size.y / 2.f);
+  barOutline.setSize(barSize);
+  barOutline.setOutlineThickness(std::max(1.f, std::round(2.f * scale)));
+  barOutline.setPosition(barPosition);
+  barFill.setSize({barSize.x * fraction, barSize.y});
+  barFill.setPosition(barPosition);
+  window.draw(barFill);
+  window.draw(barOutline);
+
+  progressText.setString(std::to_string(done) + " / " + std::to_string(total));
+  progressText.setScale({scale, scale});
+  progressText.setShadowScale(scale);
+  const sf::FloatRect progressBounds = progressText.getLocalBounds();
+  progressText.setOrigin(
+      {progressBounds.position.x + progressBounds.size.x / 2.f,
+       progressBounds.position.y});
+  progressText.setPosition({size.x / 2.f, barPosition.y + barSize.y + 16.f * scale});
+  window.draw(progressText);
+}
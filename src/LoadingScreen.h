@@ -0,0 +1,27 @@
+#ifndef OOP_LOADINGSCREEN_H
+#define OOP_LOADINGSCREEN_H
+
+#include "ShadowedText.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+
+// Progress bar shown while assets are decoded: the startup set, and a
+// game's mode assets when it starts before the menu finished prefetching
+// them. It needs only the font, so it can be up before anything else is
+// loaded.
+class LoadingScreen {
+  std::shared_ptr<const sf::Font> font;
+  ShadowedText titleText;
+  ShadowedText progressText;
+  sf::RectangleShape barOutline;
+  sf::RectangleShape barFill;
+
+public:
+  explicit LoadingScreen(const sf::String &title = "Loading PictoCraft");
+
+  // Clears the window and draws the screen; the caller displays it.
+  void draw(sf::RenderWindow &window, std::size_t done, std::size_t total);
+};
+
+#endif // OOP_LOADINGSCREEN_H
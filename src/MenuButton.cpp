@@ -1,56 +1,41 @@
 #include "MenuButton.h"
-#include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
-sf::SoundBuffer MenuButton::clickSoundBuffer;
+std::shared_ptr<const sf::SoundBuffer> MenuButton::clickSoundBuffer;
 std::unique_ptr<sf::Sound> MenuButton::clickSound = nullptr;
 bool MenuButton::soundInitialized = false;
 
-sf::Texture MenuButton::sliderHandleTexture;
-sf::Texture MenuButton::sliderHandleHighlightedTexture;
-bool MenuButton::sliderTexturesLoaded = false;
+std::shared_ptr<const sf::Texture> MenuButton::sliderHandleTexture;
+std::shared_ptr<const sf::Texture> MenuButton::sliderHandleHighlightedTexture;
 
-sf::Texture MenuButton::textFieldTexture;
-sf::Texture MenuButton::textFieldHighlightedTexture;
-bool MenuButton::textFieldTexturesLoaded = false;
+std::shared_ptr<const sf::Texture> MenuButton::textFieldTexture;
+std::shared_ptr<const sf::Texture> MenuButton::textFieldHighlightedTexture;
 
 MenuButton::MenuButton(const std::string &label, const sf::Font &font,
                        const sf::Texture &texture, unsigned int fontSize)
     : currentTexture(&texture), m_ninePatch(texture, 4, 0),
       text(font, label, fontSize), hovered(false), baseFontSize(fontSize),
       currentScale(1.0f), buttonSize(200.0f, 20.0f), position(0.0f, 0.0f) {
+  ResourceCache &cache = ResourceCache::shared();
   if (!soundInitialized) {
-    if (!clickSoundBuffer.loadFromFile("assets/sound/click.mp3")) {
-      throw AssetLoadException("assets/sound/click.mp3", "Sound");
-    }
-    clickSound = std::make_unique<sf::Sound>(clickSoundBuffer);
+    clickSoundBuffer = cache.soundBuffer("assets/sound/click.mp3");
+    clickSound = std::make_unique<sf::Sound>(*clickSoundBuffer);
     clickSound->setVolume(50.0f);
     soundInitialized = true;
   }
 
-  if (!sliderTexturesLoaded) {
-    if (!sliderHandleTexture.loadFromFile("assets/buttons/slider_handle.png")) {
-      throw AssetLoadException("assets/buttons/slider_handle.png", "Texture");
-    }
-    if (!sliderHandleHighlightedTexture.loadFromFile(
-            "assets/buttons/slider_handle_highlighted.png")) {
-      throw AssetLoadException(
-          "assets/buttons/slider_handle_highlighted.png", "Texture");
-    }
-    sliderTexturesLoaded = true;
+  if (!sliderHandleTexture) {
+    sliderHandleTexture = cache.texture("assets/buttons/slider_handle.png");
+    sliderHandleHighlightedTexture =
+        cache.texture("assets/buttons/slider_handle_highlighted.png");
   }
 
-  if (!textFieldTexturesLoaded) {
-      if (!textFieldTexture.loadFromFile("assets/buttons/text_field.png")) {
-          throw AssetLoadException("assets/buttons/text_field.png", "Texture");
-      }
-      if (!textFieldHighlightedTexture.loadFromFile("assets/buttons/text_field_highlighted.png")) {
-          throw AssetLoadException("assets/buttons/text_field_highlighted.png", "Texture");
-      }
-      textFieldTexturesLoaded = true;
+  if (!textFieldTexture) {
+      textFieldTexture = cache.texture("assets/buttons/text_field.png");
+      textFieldHighlightedTexture = cache.texture("assets/buttons/text_field_highlighted.png");
   }
 
   // setupNinePatch(); // Removed
@@ -63,6 +48,7 @@ MenuButton::~MenuButton() = default;
 void MenuButton::update(float scale, float x, float y, float widthScale,
                         float heightScale, const sf::Vector2f &mousePos) {
   currentScale = scale;
+  text.setShadowScale(scale);
   position = {std::round(x), std::round(y)};
 
   float baseWidth = 400.0f;
@@ -173,15 +159,15 @@ void MenuButton::draw(sf::RenderWindow &window) {
                              textBounds.position.y);
     text.setPosition({textX, textY});
     text.setFillColor(textColor);
-    ShadowedText::draw(window, text, currentScale);
+    window.draw(text);
   } else if (style == Style::Slider) {
     sf::Color trackColor = sf::Color::White;
     m_ninePatch.setColor(trackColor);
     window.draw(m_ninePatch);
 
     sf::Sprite handleSprite(hovered || isDragging
-                                ? sliderHandleHighlightedTexture
-                                : sliderHandleTexture);
+                                ? *sliderHandleHighlightedTexture
+                                : *sliderHandleTexture);
 
     auto handleBounds = handleSprite.getLocalBounds();
     handleSprite.setOrigin(
@@ -208,9 +194,9 @@ void MenuButton::draw(sf::RenderWindow &window) {
     text.setFillColor(sf::Color::White);
     text.setPosition({textX, textY});
 
-    ShadowedText::draw(window, text, currentScale);
+    window.draw(text);
   } else if (style == Style::TextField) {
-      const sf::Texture* texToUse = (hovered || selected) ? &textFieldHighlightedTexture : &textFieldTexture;
+      const sf::Texture* texToUse = (hovered || selected) ? textFieldHighlightedTexture.get() : textFieldTexture.get();
       if (currentTexture != texToUse) {
           const_cast<MenuButton*>(this)->setTexture(*texToUse);
       }
@@ -229,7 +215,7 @@ void MenuButton::draw(sf::RenderWindow &window) {
       text.setFillColor(sf::Color::White);
       text.setPosition({textX, textY});
       
-      ShadowedText::draw(window, text, currentScale);
+      window.draw(text);
   } else {
     sf::Color spriteColor =
         hovered ? sf::Color(160, 190, 240) : sf::Color::White;
@@ -251,6 +237,6 @@ void MenuButton::draw(sf::RenderWindow &window) {
     text.setFillColor(textColor);
     text.setPosition({textX, textY});
 
-    ShadowedText::draw(window, text, currentScale);
+    window.draw(text);
   }
 }
\ No newline at end of file
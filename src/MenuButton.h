@@ -7,6 +7,7 @@
 #include <string>
 
 #include "NinePatch.h"
+#include "ShadowedText.h"
 
 class MenuButton {
 public:
@@ -53,24 +54,22 @@ private:
 
     static constexpr NinePatchConfig DEFAULT_NINE_PATCH = {4, 10};
 
-    static sf::SoundBuffer clickSoundBuffer;
+    static std::shared_ptr<const sf::SoundBuffer> clickSoundBuffer;
     static std::unique_ptr<sf::Sound> clickSound;
     static bool soundInitialized;
 
-    static sf::Texture sliderHandleTexture;
-    static sf::Texture sliderHandleHighlightedTexture;
-    static bool sliderTexturesLoaded;
+    static std::shared_ptr<const sf::Texture> sliderHandleTexture;
+    static std::shared_ptr<const sf::Texture> sliderHandleHighlightedTexture;
 
-    static sf::Texture textFieldTexture;
-    static sf::Texture textFieldHighlightedTexture;
-    static bool textFieldTexturesLoaded;
+    static std::shared_ptr<const sf::Texture> textFieldTexture;
+    static std::shared_ptr<const sf::Texture> textFieldHighlightedTexture;
 
     std::vector<sf::Sprite> patchSprites;
     const sf::Texture *currentTexture;
     // NinePatchConfig ninePatchConfig; // Removed
     NinePatch m_ninePatch;
 
-    sf::Text text;
+    ShadowedText text;
     bool hovered;
 
     unsigned int baseFontSize;
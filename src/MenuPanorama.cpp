@@ -1,13 +1,10 @@
 #include "MenuPanorama.h"
-#include "Exceptions.h"
+#include "ResourceCache.h"
 
 MenuPanorama::MenuPanorama() : loaded(false), offset(0.0f), speed(30.0f) {
-  if (!panoramaTexture.loadFromFile("assets/cherry.jpg")) {
-    throw AssetLoadException("assets/cherry.jpg", "Texture");
-  }
-  panoramaTexture.setRepeated(true);
-  panoramaSprite1 = sf::Sprite(panoramaTexture);
-  panoramaSprite2 = sf::Sprite(panoramaTexture);
+  panoramaTexture = ResourceCache::shared().texture("assets/cherry.jpg", true);
+  panoramaSprite1 = sf::Sprite(*panoramaTexture);
+  panoramaSprite2 = sf::Sprite(*panoramaTexture);
   loaded = true;
 }
 
@@ -17,7 +14,7 @@ void MenuPanorama::update(float deltaTime) {
 
   offset += speed * deltaTime;
 
-  float textureWidth = static_cast<float>(panoramaTexture.getSize().x);
+  float textureWidth = static_cast<float>(panoramaTexture->getSize().x);
   if (offset >= textureWidth) {
     offset -= textureWidth;
   }
@@ -30,8 +27,8 @@ void MenuPanorama::draw(sf::RenderWindow &window) {
   auto winSize = window.getSize();
 
   float scaleY = static_cast<float>(winSize.y) /
-                 static_cast<float>(panoramaTexture.getSize().y);
-  float textureWidth = static_cast<float>(panoramaTexture.getSize().x) * scaleY;
+                 static_cast<float>(panoramaTexture->getSize().y);
+  float textureWidth = static_cast<float>(panoramaTexture->getSize().x) * scaleY;
 
   panoramaSprite1->setScale({scaleY, scaleY});
   panoramaSprite1->setPosition({-offset * scaleY, 0.0f});
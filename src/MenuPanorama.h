@@ -2,10 +2,11 @@
 #define OOP_MENUPANORAMA_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <optional>
 
 class MenuPanorama {
-  sf::Texture panoramaTexture;
+  std::shared_ptr<const sf::Texture> panoramaTexture;
   std::optional<sf::Sprite> panoramaSprite1;
   std::optional<sf::Sprite> panoramaSprite2;
   bool loaded;
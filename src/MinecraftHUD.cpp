@@ -1,20 +1,17 @@
 #include "MinecraftHUD.h"
 #include "Exceptions.h"
+#include "ResourceCache.h"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
 MinecraftHUD::MinecraftHUD() 
-    : hotbarSprite(hotbarTexture), showHearts(true), showHunger(true),
+    : hotbarTexture(ResourceCache::shared().texture("assets/hotbar.png")),
+      hotbarSprite(*hotbarTexture), showHearts(true), showHunger(true),
       currentHunger(20), maxHunger(20), maxHealth(10), // Default 5 hearts
       lastMistakes(0),
       hungerTimer(0.f), regenTimer(0.f), damageTimer(0.f) {
     
-    if (!hotbarTexture.loadFromFile("assets/hotbar.png")) {
-        throw AssetLoadException("assets/hotbar.png", "Texture");
-    } else {
-        hotbarSprite.setTexture(hotbarTexture);
-    }
-    
     effectDisplay.loadAssets();
 }
 
@@ -59,6 +56,16 @@ bool MinecraftHUD::update(float deltaTime, bool hasHungerEffect, bool hasSaturat
     return takeDamage;
 }
 
+void MinecraftHUD::reset() {
+    heartDisplay.reset();
+    hungerDisplay.reset();
+    currentHunger = maxHunger;
+    lastMistakes = 0;
+    hungerTimer = 0.f;
+    regenTimer = 0.f;
+    damageTimer = 0.f;
+}
+
 void MinecraftHUD::modifyHunger(int delta) {
     int oldHunger = currentHunger;
     currentHunger = std::clamp(currentHunger + delta, 0, maxHunger);
@@ -80,7 +87,7 @@ void MinecraftHUD::draw(sf::RenderWindow& window, int score, int currentMistakes
     float hotbarY = static_cast<float>(winSize.y) - bottomPadding;
     
 
-    auto hotbarSize = hotbarTexture.getSize();
+    auto hotbarSize = hotbarTexture->getSize();
     float hotbarScale = uiScale * 2.5f;
     float hotbarHeight = 22.f * hotbarScale;
     float hotbarWidth = 182.f * hotbarScale;
@@ -88,23 +95,52 @@ void MinecraftHUD::draw(sf::RenderWindow& window, int score, int currentMistakes
     if (hotbarSize.x > 0 && hotbarSize.y > 0) {
         hotbarHeight = static_cast<float>(hotbarSize.y) * hotbarScale;
         hotbarWidth = static_cast<float>(hotbarSize.x) * hotbarScale;
+    }
+    
+    float xpBarY = hotbarY - hotbarHeight - 10.f * uiScale;
+    float statsY = xpBarY - 32.f * uiScale;
+    
+    int level = XPBar::levelFor(score);
+    if (winSize != barWindowSize || level != barLevel) {
+        // Whole pixels, so the cached band lands texel for pixel
+        barCachePosition = {std::floor(centerX - hotbarWidth / 2.f) - 4.f,
+                            std::floor(statsY)};
+        sf::Vector2u size = {
+            static_cast<unsigned int>(std::ceil(hotbarWidth)) + 8u,
+            static_cast<unsigned int>(std::max(1.f, static_cast<float>(winSize.y) - barCachePosition.y))};
+        if (size != barCacheSize) {
+            if (!barCache.resize(size)) {
+                throw AssetLoadException("HUD bar", "Render Texture");
+            }
+            barCacheSize = size;
+        }
+        barCache.setView(sf::View(sf::FloatRect(barCachePosition, sf::Vector2f(size))));
+        barCache.clear(sf::Color::Transparent);
+        
+        if (hotbarSize.x > 0 && hotbarSize.y > 0) {
+            hotbarSprite.setColor(sf::Color::White); 
+            hotbarSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(static_cast<int>(hotbarSize.x), static_cast<int>(hotbarSize.y))));
+            
+            hotbarSprite.setScale({hotbarScale, hotbarScale});
+            hotbarSprite.setOrigin({static_cast<float>(hotbarSize.x) / 2.f, static_cast<float>(hotbarSize.y)});
+            hotbarSprite.setPosition({centerX, hotbarY});
+            barCache.draw(hotbarSprite);
+        }
         
-        hotbarSprite.setColor(sf::Color::White); 
-        hotbarSprite.setTextureRect(sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(static_cast<int>(hotbarSize.x), static_cast<int>(hotbarSize.y))));
+        // XP BAR
+        xpBar.draw(barCache, score, {centerX, xpBarY}, hotbarScale);
         
-        hotbarSprite.setScale({hotbarScale, hotbarScale});
-        hotbarSprite.setOrigin({static_cast<float>(hotbarSize.x) / 2.f, static_cast<float>(hotbarSize.y)});
-        hotbarSprite.setPosition({centerX, hotbarY});
-        window.draw(hotbarSprite);
+        barCache.display();
+        barWindowSize = winSize;
+        barLevel = level;
+        ++barRedraws;
     }
     
-    // XP BAR
-    float xpBarY = hotbarY - hotbarHeight - 10.f * uiScale;
-    xpBar.draw(window, score, {centerX, xpBarY}, hotbarScale);
+    sf::Sprite bar(barCache.getTexture());
+    bar.setPosition(barCachePosition);
+    window.draw(bar);
     
     // HEARTS AND HUNGER
-    float statsY = xpBarY - 32.f * uiScale;
-    
     if (currentMistakes > lastMistakes) {
         heartDisplay.triggerFlash();
     } else if (currentMistakes < lastMistakes) {
@@ -7,9 +7,10 @@
 #include "XPBar.h"
 #include "EffectDisplay.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class MinecraftHUD {
-    sf::Texture hotbarTexture;
+    std::shared_ptr<const sf::Texture> hotbarTexture;
     sf::Sprite hotbarSprite;
     
     HeartDisplay heartDisplay;
@@ -25,6 +26,17 @@ class MinecraftHUD {
     int maxHealth; // Max health (10 = 5 hearts, 20 = 10 hearts)
     
     mutable int lastMistakes;
+
+    // Hotbar, XP bar and level number as they look at the current window
+    // size, covering the bottom of the window from the stats row down.
+    // Repainted only when the level or the window size changes; hearts and
+    // hunger keep their own icon rows so they can blink and shake.
+    sf::RenderTexture barCache;
+    sf::Vector2u barCacheSize;
+    sf::Vector2f barCachePosition;
+    sf::Vector2u barWindowSize;
+    int barLevel = -1;
+    int barRedraws = 0;
     
     // Mechanics
     float hungerTimer;    // Accumulates time for hunger decay
@@ -48,10 +60,19 @@ public:
     
     // Hunger management
     void modifyHunger(int delta);
+
+    // Back to a full hunger bar with no effects running, for a new game.
+    // The cached bar is kept; it repaints on its own if the level differs.
+    void reset();
     
     // Draw the full HUD at bottom center of screen
     void draw(sf::RenderWindow& window, int score, int currentMistakes, int maxMistakes,
               bool isPoisoned = false, bool hasHungerEffect = false, bool isWithered = false);
+
+    // Times any cached part of the HUD was repainted.
+    [[nodiscard]] int getRedrawCount() const {
+        return barRedraws + heartDisplay.getRedrawCount() + hungerDisplay.getRedrawCount();
+    }
 };
 
 #endif // MINECRAFT_HUD_H
@@ -1,14 +1,12 @@
 #include "MistakesMode.h"
-#include "Exceptions.h"
+#include "ResourceCache.h"
 
-MistakesMode::MistakesMode() : hurtSound(hurtBuffer) {
-  if (!hurtBuffer.loadFromFile("assets/sound/hurt.mp3")) {
-    throw AssetLoadException("assets/sound/hurt.mp3", "Sound");
-  }
-}
+MistakesMode::MistakesMode()
+    : hurtBuffer(ResourceCache::shared().soundBuffer("assets/sound/hurt.mp3")),
+      hurtSound(*hurtBuffer) {}
 
 MistakesMode::MistakesMode(const MistakesMode &other)
-    : GameMode(other), hurtBuffer(other.hurtBuffer), hurtSound(hurtBuffer) {
+    : GameMode(other), hurtBuffer(other.hurtBuffer), hurtSound(*hurtBuffer) {
   mistakes = other.mistakes;
   score = other.score;
 }
@@ -3,6 +3,7 @@
 
 #include "GameMode.h"
 #include <SFML/Audio.hpp>
+#include <memory>
 
 class MistakesMode : public GameMode {
 public:
@@ -19,7 +20,7 @@ public:
   [[nodiscard]] std::string getName() const override { return "Mistakes Mode"; }
 
 private:
-  sf::SoundBuffer hurtBuffer;
+  std::shared_ptr<const sf::SoundBuffer> hurtBuffer;
   sf::Sound hurtSound;
 };
 
@@ -1,6 +1,7 @@
 #ifndef PARTICLE_TEMPLATES_H
 #define PARTICLE_TEMPLATES_H
 
+#include "TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 
@@ -54,13 +55,16 @@ template <typename Trait>
 class TemplateParticleSystem {
     std::vector<TemplateParticle> particles;
     sf::VertexArray vertices;
-    std::vector<const sf::Texture*> textures; // Animated frames
+    std::vector<AtlasRegion> frames; // Animated frames
 
 public:
     TemplateParticleSystem() : vertices(sf::PrimitiveType::Triangles) {} 
     
-    void addTexture(const sf::Texture* tex) { textures.push_back(tex); }
-    void clearTextures() { textures.clear(); }
+    void addFrame(const AtlasRegion& frame) { frames.push_back(frame); }
+    void addTexture(const sf::Texture* tex) {
+        frames.push_back({tex, sf::IntRect({0, 0}, sf::Vector2i(tex->getSize()))});
+    }
+    void clearTextures() { frames.clear(); }
 
     void emit(sf::Vector2f position, int count, sf::Color color = sf::Color::White, float scale = 1.0f) {
         for(int i=0; i<count; ++i) {
@@ -85,19 +89,21 @@ public:
     }
 
     void draw(sf::RenderWindow& window) {
-        if(textures.empty()) return;
+        if(frames.empty()) return;
 
         sf::RenderStates states;
         states.blendMode = Trait::getBlendMode();
 
-        for(size_t i = 0; i < textures.size(); ++i) {
-             const sf::Texture* tex = textures[i];
-             if(!tex) continue;
-             sf::Vector2f texSize = static_cast<sf::Vector2f>(tex->getSize());
+        // One batch per texture page; frames packed on a single atlas page
+        // draw every particle in one call.
+        for(size_t i = 0; i < frames.size(); ++i) {
+             const sf::Texture* page = frames[i].page;
+             bool seen = false;
+             for(size_t k = 0; k < i && !seen; ++k) seen = frames[k].page == page;
+             if(!page || seen) continue;
              
              vertices.clear();
              
-             // Collect particles for this frame
              for(const auto& p : particles) {
                  int frameIndex = 0;
                  
@@ -107,31 +113,34 @@ public:
                      float ratio = p.lifetime / p.maxLifetime;
                      // Index: 0 to N-1.
                      // ratio goes from 1.0 (start) to 0.0 (end)
-                     // We want index to go from (textures.size() - 1) down to 0.
-                     frameIndex = static_cast<int>(ratio * (static_cast<float>(textures.size()) - 0.0001f)); 
+                     // We want index to go from (frames.size() - 1) down to 0.
+                     frameIndex = static_cast<int>(ratio * (static_cast<float>(frames.size()) - 0.0001f)); 
                  }
                  
-                 // Clamp frameIndex to valid range [0, textures.size() - 1]
-                 if(frameIndex >= static_cast<int>(textures.size())) frameIndex = static_cast<int>(textures.size()) - 1;
+                 // Clamp frameIndex to valid range [0, frames.size() - 1]
+                 if(frameIndex >= static_cast<int>(frames.size())) frameIndex = static_cast<int>(frames.size()) - 1;
                  if(frameIndex < 0) frameIndex = 0;
                  
-                 if (frameIndex == static_cast<int>(i)) {
+                 const AtlasRegion& frame = frames[static_cast<size_t>(frameIndex)];
+                 if (frame.page == page) {
                     sf::Vector2f pos = p.position;
                     float s = p.size;
                     sf::Color c = p.color;
+                    const sf::Vector2f t0(frame.rect.position);
+                    const sf::Vector2f t1 = t0 + sf::Vector2f(frame.rect.size);
                     
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, -s}, c, sf::Vector2f{0.f, 0.f}});
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, -s}, c, sf::Vector2f{texSize.x, 0.f}});
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, s}, c, sf::Vector2f{0.f, texSize.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, -s}, c, sf::Vector2f{t0.x, t0.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, -s}, c, sf::Vector2f{t1.x, t0.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, s}, c, sf::Vector2f{t0.x, t1.y}});
                     
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, s}, c, sf::Vector2f{0.f, texSize.y}});
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, -s}, c, sf::Vector2f{texSize.x, 0.f}});
-                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, s}, c, sf::Vector2f{texSize.x, texSize.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{-s, s}, c, sf::Vector2f{t0.x, t1.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, -s}, c, sf::Vector2f{t1.x, t0.y}});
+                    vertices.append(sf::Vertex{pos + sf::Vector2f{s, s}, c, sf::Vector2f{t1.x, t1.y}});
                  }
              }
              
              if(vertices.getVertexCount() > 0) {
-                 states.texture = tex;
+                 states.texture = page;
                  window.draw(vertices, states);
              }
         }
@@ -1,17 +1,12 @@
 #include "PauseMenu.h"
-#include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
 #include <cmath>
 
-PauseMenu::PauseMenu() : font(), titleText(font) {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-
-  if (!pauseTexture.loadFromFile("assets/dirt.png")) {
-    throw AssetLoadException("assets/dirt.png", "Texture");
-  }
-  pauseSprite.emplace(pauseTexture);
+PauseMenu::PauseMenu()
+    : font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      titleText(*font),
+      pauseTexture(ResourceCache::shared().texture("assets/dirt.png")) {
+  pauseSprite.emplace(*pauseTexture);
 
   titleText.setString("Game Paused");
   titleText.setCharacterSize(60);
@@ -21,17 +16,12 @@ PauseMenu::PauseMenu() : font(), titleText(font) {
 }
 
 void PauseMenu::createButtons() {
-  static sf::Texture buttonTexture;
-  if (buttonTexture.getSize().x == 0) {
-    if (!buttonTexture.loadFromFile("assets/buttons/button.png")) {
-      throw AssetLoadException("assets/buttons/button.png", "Texture");
-    }
-  }
+  buttonTexture = ResourceCache::shared().texture("assets/buttons/button.png");
 
   buttons.push_back(
-      std::make_unique<MenuButton>("Resume Game", font, buttonTexture, 20));
+      std::make_unique<MenuButton>("Resume Game", *font, *buttonTexture, 20));
   buttons.push_back(
-      std::make_unique<MenuButton>("Exit to Menu", font, buttonTexture, 20));
+      std::make_unique<MenuButton>("Exit to Menu", *font, *buttonTexture, 20));
 }
 
 sf::Vector2f PauseMenu::calculateScale(const sf::RenderWindow &window) const {
@@ -70,7 +60,7 @@ void PauseMenu::update(const sf::RenderWindow &window) {
   auto [scale, scaleY] = calculateScale(window);
 
   // Update pause background sprite to fill window
-  auto texSize = pauseTexture.getSize();
+  auto texSize = pauseTexture->getSize();
   float scaleX = static_cast<float>(winSize.x) / static_cast<float>(texSize.x);
   float scaleYSprite = static_cast<float>(winSize.y) / static_cast<float>(texSize.y);
   pauseSprite->setScale({scaleX, scaleYSprite});
@@ -78,6 +68,7 @@ void PauseMenu::update(const sf::RenderWindow &window) {
 
   // Title
   titleText.setCharacterSize(static_cast<unsigned int>(60.0f * scale));
+  titleText.setShadowScale(scale);
   auto titleBounds = titleText.getLocalBounds();
   titleText.setPosition(
       {(static_cast<float>(winSize.x) - titleBounds.size.x) / 2.0f -
@@ -96,12 +87,10 @@ void PauseMenu::update(const sf::RenderWindow &window) {
 }
 
 void PauseMenu::draw(sf::RenderWindow &window) const {
-  auto [scale, scaleY] = calculateScale(window);
-
   if (pauseSprite) {
     window.draw(*pauseSprite);
   }
-  ShadowedText::draw(window, titleText, scale);
+  window.draw(titleText);
 
   for (const auto &btn : buttons) {
     btn->draw(window);
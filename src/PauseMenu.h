@@ -2,6 +2,7 @@
 #define OOP_PAUSEMENU_H
 
 #include "MenuButton.h"
+#include "ShadowedText.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <optional>
@@ -10,9 +11,10 @@
 enum class PauseAction { None, Resume, MainMenu };
 
 class PauseMenu {
-  sf::Font font;
-  sf::Text titleText;
-  sf::Texture pauseTexture;
+  std::shared_ptr<const sf::Font> font;
+  ShadowedText titleText;
+  std::shared_ptr<const sf::Texture> pauseTexture;
+  std::shared_ptr<const sf::Texture> buttonTexture;
   std::optional<sf::Sprite> pauseSprite;
 
   std::vector<std::unique_ptr<MenuButton>> buttons;
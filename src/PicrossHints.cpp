@@ -1,4 +1,5 @@
 #include "PicrossHints.h"
+#include "BitKernels.h"
 #include <algorithm>
 #include <iostream>
 
@@ -6,88 +7,138 @@ PicrossHints::PicrossHints(const std::vector<std::vector<bool> > &grid) {
     if (grid.empty())
         return;
 
+    std::vector<int> current;
+
     // Calculate row hints
     for (const auto &row: grid) {
-        std::vector<int> current_row_hints;
+        current.clear();
         int count = 0;
         for (bool cell: row) {
             if (cell) {
                 count++;
             } else if (count > 0) {
-                current_row_hints.push_back(count);
+                current.push_back(count);
                 count = 0;
             }
         }
         if (count > 0) {
-            current_row_hints.push_back(count);
-        }
-        if (current_row_hints.empty()) {
-            current_row_hints.push_back(0);
+            current.push_back(count);
         }
-        row_hints.push_back(current_row_hints);
+        append_line(current);
     }
 
     // Calculate col hints
-    size_t cols = grid[0].size();
-    for (size_t j = 0; j < cols; ++j) {
-        std::vector<int> current_col_hints;
+    size_t colCount = grid[0].size();
+    for (size_t j = 0; j < colCount; ++j) {
+        current.clear();
         int count = 0;
-        for (const auto & i : grid) {
+        for (const auto &i: grid) {
             if (i[j]) {
                 count++;
             } else if (count > 0) {
-                current_col_hints.push_back(count);
+                current.push_back(count);
                 count = 0;
             }
         }
         if (count > 0) {
-            current_col_hints.push_back(count);
+            current.push_back(count);
         }
-        if (current_col_hints.empty()) {
-            current_col_hints.push_back(0);
-        }
-        col_hints.push_back(current_col_hints);
+        append_line(current);
     }
 
-    // Initialize webbed state (0 health = not webbed)
-    row_hints_webbed.resize(row_hints.size());
-    for (size_t i = 0; i < row_hints.size(); ++i) {
-        row_hints_webbed[i].resize(row_hints[i].size(), 0);
+    finish(static_cast<int>(grid.size()), static_cast<int>(colCount));
+}
+
+PicrossHints::PicrossHints(const BitBoard &board) {
+    const int n = board.size();
+    reserve_lines(2 * n, n);
+    std::vector<int> runs;
+    for (int i = 0; i < n; ++i) {
+        runs.clear();
+        BitKernels::extract_runs(board.row(i).words(), runs);
+        append_line(runs);
     }
+    for (int j = 0; j < n; ++j) {
+        runs.clear();
+        BitKernels::extract_runs(board.col(j).words(), runs);
+        append_line(runs);
+    }
+    finish(n, n);
+}
 
-    col_hints_webbed.resize(col_hints.size());
-    for (size_t i = 0; i < col_hints.size(); ++i) {
-        col_hints_webbed[i].resize(col_hints[i].size(), 0);
+PicrossHints::PicrossHints(std::span<const std::uint64_t> rowWords, int size) {
+    if (size <= 0)
+        return;
+
+    const auto words = static_cast<size_t>(BitKernels::line_words(size));
+    std::vector<std::uint64_t> colWords(words * size);
+    BitKernels::transpose(rowWords, size, colWords);
+
+    reserve_lines(2 * size, size);
+    std::vector<int> runs;
+    for (size_t i = 0; i < static_cast<size_t>(size); ++i) {
+        runs.clear();
+        BitKernels::extract_runs(rowWords.subspan(i * words, words), runs);
+        append_line(runs);
+    }
+    for (size_t j = 0; j < static_cast<size_t>(size); ++j) {
+        runs.clear();
+        BitKernels::extract_runs(std::span(colWords).subspan(j * words, words), runs);
+        append_line(runs);
     }
+    finish(size, size);
 }
 
-size_t PicrossHints::get_max_row_width() const {
-    size_t max_width = 0;
-    for (const auto &row: row_hints) {
-        max_width = std::max(max_width, row.size());
+void PicrossHints::reserve_lines(int lineCount, int lineLength) {
+    offsets.reserve(static_cast<size_t>(lineCount) + 1);
+    // Random boards average about one clue per four cells of a line
+    clues.reserve(static_cast<size_t>(lineCount) * (lineLength / 4 + 1));
+}
+
+void PicrossHints::append_line(std::span<const int> runs) {
+    if (runs.empty()) {
+        clues.push_back(0); // An empty line is shown as a single 0 clue
+    } else {
+        for (int run: runs) {
+            clues.push_back(static_cast<std::uint16_t>(run));
+        }
     }
-    return max_width;
+    offsets.push_back(static_cast<std::uint32_t>(clues.size()));
 }
 
-size_t PicrossHints::get_max_col_height() const {
-    size_t max_height = 0;
-    for (const auto &col: col_hints) {
-        max_height = std::max(max_height, col.size());
+void PicrossHints::finish(int rowCount, int colCount) {
+    rows = rowCount;
+    cols = colCount;
+
+    max_row_width = 0;
+    for (int i = 0; i < rows; ++i) {
+        max_row_width = std::max(max_row_width, get_row(i).size());
+    }
+    max_col_height = 0;
+    for (int j = 0; j < cols; ++j) {
+        max_col_height = std::max(max_col_height, get_col(j).size());
     }
-    return max_height;
+
+    // Initialize webbed state (0 health = not webbed)
+    web_health.assign(clues.size(), 0);
+}
+
+int PicrossHints::clue_slot(bool isRow, int line, int index) const {
+    const int lineCount = isRow ? rows : cols;
+    if (line < 0 || line >= lineCount || index < 0)
+        return -1;
+    const int k = isRow ? line : rows + line;
+    const auto slot = offsets[k] + static_cast<std::uint32_t>(index);
+    return slot < offsets[k + 1] ? static_cast<int>(slot) : -1;
 }
 
 void PicrossHints::setWebHealth(bool isRow, int line, int index, int health) {
-    if (isRow) {
-        if (line >= 0 && line < row_hints_webbed.size() && index >= 0 &&
-            index < row_hints_webbed[line].size()) {
-            row_hints_webbed[line][index] = health;
-        }
-    } else {
-        if (line >= 0 && line < col_hints_webbed.size() && index >= 0 &&
-            index < col_hints_webbed[line].size()) {
-            col_hints_webbed[line][index] = health;
-        }
+    const int slot = clue_slot(isRow, line, index);
+    if (slot >= 0) {
+        const bool wasWebbed = web_health[slot] > 0;
+        web_health[slot] = static_cast<std::uint8_t>(std::clamp(health, 0, 255));
+        if (wasWebbed != (web_health[slot] > 0))
+            ++web_version;
     }
 }
 
@@ -96,34 +147,32 @@ bool PicrossHints::isWebbed(bool isRow, int line, int index) const {
 }
 
 int PicrossHints::getWebHealth(bool isRow, int line, int index) const {
-    if (isRow) {
-        if (line >= 0 && line < row_hints_webbed.size() && index >= 0 &&
-            index < row_hints_webbed[line].size()) {
-            return row_hints_webbed[line][index];
-        }
-    } else {
-        if (line >= 0 && line < col_hints_webbed.size() && index >= 0 &&
-            index < col_hints_webbed[line].size()) {
-            return col_hints_webbed[line][index];
-        }
+    const int slot = clue_slot(isRow, line, index);
+    return slot >= 0 ? web_health[slot] : 0;
+}
+
+void PicrossHints::healWebs(int health) {
+    const auto full = static_cast<std::uint8_t>(std::clamp(health, 0, 255));
+    for (auto &h: web_health) {
+        if (h > 0 && h < full)
+            h = full;
     }
-    return 0;
 }
 
 std::ostream &operator<<(std::ostream &os, const PicrossHints &hints) {
     os << "Row Hints:\n";
-    for (const auto &row: hints.row_hints) {
-        for (int val: row) {
+    for (int i = 0; i < hints.get_row_count(); ++i) {
+        for (int val: hints.get_row(i)) {
             os << val << " ";
         }
         os << "\n";
     }
     os << "Col Hints:\n";
-    for (const auto &col: hints.col_hints) {
-        for (int val: col) {
+    for (int j = 0; j < hints.get_col_count(); ++j) {
+        for (int val: hints.get_col(j)) {
             os << val << " ";
         }
         os << "\n";
     }
     return os;
-}
\ No newline at end of file
+}
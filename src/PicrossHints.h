@@ -4,31 +4,55 @@
 
 #ifndef OOP_PICROSSHINTS_H
 #define OOP_PICROSSHINTS_H
+#include <cstdint>
 #include <iosfwd>
+#include <span>
 #include <vector>
 
+#include "BitBoard.h"
+
 class PicrossHints {
-    std::vector<std::vector<int> > row_hints;
-    std::vector<std::vector<int> > col_hints;
-    std::vector<std::vector<int> > row_hints_webbed;
-    std::vector<std::vector<int> > col_hints_webbed;
+    // Compressed-sparse-row layout: the clues of line k are
+    // clues[offsets[k] .. offsets[k + 1]). Rows come first, then columns.
+    std::vector<std::uint16_t> clues;
+    std::vector<std::uint32_t> offsets{0};
+    // Web health per clue, same indexing as clues (0 = not webbed).
+    std::vector<std::uint8_t> web_health;
+    std::uint32_t web_version = 0; // bumped when a clue gets or loses a web
+    int rows = 0;
+    int cols = 0;
+    size_t max_row_width = 0;
+    size_t max_col_height = 0;
 
 public:
     PicrossHints() = default;
 
     explicit PicrossHints(const std::vector<std::vector<bool> > &grid);
 
-    [[nodiscard]] const std::vector<std::vector<int> > &get_row_hints() const {
-        return row_hints;
+    explicit PicrossHints(const BitBoard &board);
+
+    // Bulk entry point: size x size board given as row-major words,
+    // BitKernels::line_words(size) words per row. Columns are obtained by
+    // a blocked bit transpose, so no per-cell work is done.
+    PicrossHints(std::span<const std::uint64_t> rows, int size);
+
+    [[nodiscard]] int get_row_count() const { return rows; }
+
+    [[nodiscard]] int get_col_count() const { return cols; }
+
+    // Unchecked; line must be in [0, get_row_count()).
+    [[nodiscard]] std::span<const std::uint16_t> get_row(int line) const {
+        return line_clues(line);
     }
 
-    [[nodiscard]] const std::vector<std::vector<int> > &get_col_hints() const {
-        return col_hints;
+    // Unchecked; line must be in [0, get_col_count()).
+    [[nodiscard]] std::span<const std::uint16_t> get_col(int line) const {
+        return line_clues(rows + line);
     }
 
-    [[nodiscard]] size_t get_max_row_width() const;
+    [[nodiscard]] size_t get_max_row_width() const { return max_row_width; }
 
-    [[nodiscard]] size_t get_max_col_height() const;
+    [[nodiscard]] size_t get_max_col_height() const { return max_col_height; }
 
     void setWebHealth(bool isRow, int line, int index, int health);
 
@@ -36,7 +60,28 @@ public:
 
     [[nodiscard]] int getWebHealth(bool isRow, int line, int index) const;
 
+    // Restores every webbed clue to the given health in one flat pass.
+    void healWebs(int health);
+
+    // Changes whenever the set of webbed clues does; health changes alone
+    // leave it as is. Lets renderers cache the clue layout.
+    [[nodiscard]] std::uint32_t get_web_version() const { return web_version; }
+
     friend std::ostream &operator<<(std::ostream &os, const PicrossHints &hints);
+
+private:
+    [[nodiscard]] std::span<const std::uint16_t> line_clues(int k) const {
+        return std::span(clues).subspan(offsets[k], offsets[k + 1] - offsets[k]);
+    }
+
+    // Index into clues/web_health, or -1 when out of range.
+    [[nodiscard]] int clue_slot(bool isRow, int line, int index) const;
+
+    void reserve_lines(int lineCount, int lineLength);
+
+    void append_line(std::span<const int> runs);
+
+    void finish(int rowCount, int colCount);
 };
 
-#endif // OOP_PICROSSHINTS_H
\ No newline at end of file
+#endif // OOP_PICROSSHINTS_H
@@ -0,0 +1,195 @@
+#include "PuzzleGenerator.h"
+#include "BitBoard.h"
+#include "BitKernels.h"
+#include "Exceptions.h"
+#include "LineSolver.h"
+#include "PicrossHints.h"
+#include "PuzzleSolver.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+
+namespace {
+// Boards started per call before giving up on a logic-only puzzle
+constexpr int kMaxCandidates = 64;
+
+std::uint64_t candidate_seed(std::uint64_t seed, int index) {
+  return seed + static_cast<std::uint64_t>(index) * 0x9E3779B97F4A7C15ULL;
+}
+
+// Undecided cells of one word of row r, optionally only those empty in the
+// board, with the bits past the end of the row cleared.
+std::uint64_t open_cells(const BitBoard &filled, const BitBoard &empty,
+                         const BitBoard *board, int r, std::size_t w) {
+  const int n = filled.size();
+  std::uint64_t open =
+      ~(filled.row(r).words()[w] | empty.row(r).words()[w]);
+  if (board)
+    open &= ~board->row(r).words()[w];
+  const int base = static_cast<int>(w) * 64;
+  if (n - base < 64)
+    open &= (std::uint64_t{1} << (n - base)) - 1;
+  return open;
+}
+
+// Uniformly random undecided cell, or {-1, -1} if there is none. Passing
+// the board restricts the pick to cells that are empty in it.
+std::pair<int, int> pick_undecided(const BitBoard &filled,
+                                   const BitBoard &empty,
+                                   const BitBoard *board,
+                                   std::mt19937_64 &gen) {
+  const int n = filled.size();
+  const std::size_t words = static_cast<std::size_t>(filled.line_words());
+  int total = 0;
+  for (int r = 0; r < n; ++r)
+    for (std::size_t w = 0; w < words; ++w)
+      total += std::popcount(open_cells(filled, empty, board, r, w));
+  if (total == 0)
+    return {-1, -1};
+
+  int target = std::uniform_int_distribution<int>(0, total - 1)(gen);
+  for (int r = 0; r < n; ++r) {
+    for (std::size_t w = 0; w < words; ++w) {
+      std::uint64_t open = open_cells(filled, empty, board, r, w);
+      const int count = std::popcount(open);
+      if (target >= count) {
+        target -= count;
+        continue;
+      }
+      for (; target > 0; --target)
+        open &= open - 1;
+      return {r, static_cast<int>(w) * 64 + std::countr_zero(open)};
+    }
+  }
+  return {-1, -1};
+}
+} // namespace
+
+PuzzleGenerator::PuzzleGenerator(int size, double density_val)
+    : n{size}, density{density_val} {
+  if (size <= 0) {
+    throw InvalidGridException("Grid size must be positive: " +
+                               std::to_string(size));
+  }
+}
+
+bool PuzzleGenerator::build(std::uint64_t seed, const std::atomic<bool> &stop,
+                            GeneratedPuzzle &out) const {
+  std::mt19937_64 gen(seed);
+  std::bernoulli_distribution cell(std::clamp(density, 0.0, 1.0));
+  const int words = BitKernels::line_words(n);
+  std::vector<std::uint64_t> rows(static_cast<std::size_t>(n) * words, 0);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (cell(gen))
+        rows[static_cast<std::size_t>(i) * words + (j >> 6)] |=
+            std::uint64_t{1} << (j & 63);
+    }
+  }
+
+  BitBoard board(n, rows);
+  PicrossHints hints(board);
+  LineSolver solver;
+  std::vector<int> allLines(2 * static_cast<std::size_t>(n));
+  std::iota(allLines.begin(), allLines.end(), 0);
+
+  BitBoard filled(n);
+  BitBoard empty(n);
+  int known = 0;
+  PuzzleSolver::propagate(hints, filled, empty, known, allLines, solver);
+
+  const int cells = n * n;
+  const int maxRepairs = std::max(8, cells / 4);
+  int repairs = 0;
+  while (true) {
+    if (known == cells) {
+      // Cells kept across repairs were deduced from older clues; only a
+      // fresh propagation proves the final clues are enough on their own.
+      BitBoard freshFilled(n);
+      BitBoard freshEmpty(n);
+      int freshKnown = 0;
+      PuzzleSolver::propagate(hints, freshFilled, freshEmpty, freshKnown,
+                              allLines, solver);
+      filled = std::move(freshFilled);
+      empty = std::move(freshEmpty);
+      known = freshKnown;
+      if (known == cells)
+        break;
+    }
+    if (stop || repairs == maxRepairs) {
+      out.rows.assign(board.row_words().begin(), board.row_words().end());
+      out.repairs = repairs;
+      return false;
+    }
+
+    // Filling an undecided empty cell is preferred: sparse boards are what
+    // leave line logic stuck, and flipping filled cells off tends to wander.
+    // The known cells all agree with the board and the flipped cell is not
+    // one of them, so resuming propagation cannot hit a contradiction.
+    auto [r, c] = pick_undecided(filled, empty, &board, gen);
+    if (r < 0)
+      std::tie(r, c) = pick_undecided(filled, empty, nullptr, gen);
+    board.flip(r, c);
+    ++repairs;
+    hints = PicrossHints(board);
+    const int touched[] = {r, n + c};
+    PuzzleSolver::propagate(hints, filled, empty, known, touched, solver);
+  }
+
+  out.rows.assign(board.row_words().begin(), board.row_words().end());
+  out.repairs = repairs;
+  out.logic_solvable = true;
+  return true;
+}
+
+GeneratedPuzzle PuzzleGenerator::generate(std::uint64_t seed,
+                                          ThreadPool *pool) const {
+  GeneratedPuzzle result;
+  std::atomic<bool> stop{false};
+
+  if (!pool) {
+    for (int i = 0; i < kMaxCandidates; ++i) {
+      result.candidates = i + 1;
+      if (build(candidate_seed(seed, i), stop, result))
+        break;
+    }
+    return result;
+  }
+
+  std::atomic<int> next{0};
+  std::mutex mutex;
+  std::condition_variable idle;
+  int pending = static_cast<int>(pool->size());
+  int started = 0;
+
+  for (std::size_t t = 0; t < pool->size(); ++t) {
+    pool->submit([&] {
+      for (int i = next++; i < kMaxCandidates && !stop; i = next++) {
+        GeneratedPuzzle candidate;
+        const bool ok = build(candidate_seed(seed, i), stop, candidate);
+        std::lock_guard lock(mutex);
+        ++started;
+        if (!result.logic_solvable && (ok || !stop)) {
+          candidate.candidates = result.candidates;
+          result = std::move(candidate);
+          stop = stop || ok;
+        }
+      }
+      std::lock_guard lock(mutex);
+      if (--pending == 0)
+        idle.notify_all();
+    });
+  }
+
+  std::unique_lock lock(mutex);
+  idle.wait(lock, [&] { return pending == 0; });
+  result.candidates = started;
+  return result;
+}
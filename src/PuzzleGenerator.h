@@ -0,0 +1,43 @@
+#ifndef OOP_PUZZLEGENERATOR_H
+#define OOP_PUZZLEGENERATOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+struct GeneratedPuzzle {
+  std::vector<std::uint64_t> rows; // line_words(size) words per row
+  bool logic_solvable = false;     // false only if every candidate failed
+  int candidates = 0;              // boards started, across all threads
+  int repairs = 0;                 // cells flipped in the winning board
+};
+
+// Random boards whose clues determine them by line logic alone, and hence
+// have exactly one solution. Each candidate starts as random noise at the
+// requested density and is propagated; while cells stay undetermined, one
+// of them is flipped in the board, which changes the clues of its row and
+// column only, and propagation resumes from what was already known with
+// just those two lines queued. A board that propagates fully is confirmed
+// by one last propagation from an empty board.
+//
+// Candidates run speculatively on the pool and the first confirmed board
+// wins. The number of candidates and the flips per candidate are capped,
+// so a call ends in bounded time even when no candidate succeeds; the last
+// board tried is then returned with logic_solvable unset.
+class PuzzleGenerator {
+  int n;
+  double density;
+
+  bool build(std::uint64_t seed, const std::atomic<bool> &stop,
+             GeneratedPuzzle &out) const;
+
+public:
+  PuzzleGenerator(int size, double density);
+
+  [[nodiscard]] GeneratedPuzzle generate(std::uint64_t seed,
+                                         ThreadPool *pool = nullptr) const;
+};
+
+#endif // OOP_PUZZLEGENERATOR_H
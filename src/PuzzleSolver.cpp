@@ -0,0 +1,295 @@
+#include "PuzzleSolver.h"
+#include "Exceptions.h"
+#include "LineSolver.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace {
+// Branch levels whose second side is handed to the pool. Below that the
+// subtrees are usually small enough that queueing them costs more than it
+// saves; idle workers still pick up the shallow tasks by stealing.
+constexpr int kSpawnDepth = 8;
+
+// Cells probed per search node before branching.
+constexpr std::size_t kProbeCells = 24;
+
+struct State {
+  BitBoard filled;
+  BitBoard empty;
+  int known = 0;
+};
+
+class Search {
+  const PicrossHints &hints;
+  const int n;
+  const std::chrono::steady_clock::time_point deadline;
+  ThreadPool *pool;
+
+  std::atomic<int> found{0};
+  std::atomic<long> branches{0};
+  std::atomic<bool> gave_up{false};
+  std::atomic<bool> guessed{false};
+
+  std::mutex result_mutex;
+  std::vector<BitBoard> solutions;
+
+  std::mutex wait_mutex;
+  std::condition_variable idle;
+  int pending = 0;
+
+  [[nodiscard]] bool stopped() const { return found >= 2 || gave_up; }
+
+  // Flags the search as given up once the deadline has passed.
+  bool out_of_time() {
+    if (std::chrono::steady_clock::now() >= deadline)
+      gave_up = true;
+    return gave_up;
+  }
+
+  bool propagate(State &st, const std::vector<int> &seeds,
+                 LineSolver &solver) const {
+    return PuzzleSolver::propagate(hints, st.filled, st.empty, st.known, seeds,
+                                   solver);
+  }
+
+  // Unknown cells of the lines with the fewest unknown cells, up to limit.
+  [[nodiscard]] std::vector<std::pair<int, int>>
+  probe_cells(const State &st, std::size_t limit) const {
+    std::vector<std::pair<int, int>> order; // (unknown count, line id)
+    for (int id = 0; id < 2 * n; ++id) {
+      const bool isRow = id < n;
+      const int line = isRow ? id : id - n;
+      const int known = isRow ? st.filled.row(line).count() +
+                                    st.empty.row(line).count()
+                              : st.filled.col(line).count() +
+                                    st.empty.col(line).count();
+      if (known < n)
+        order.emplace_back(n - known, id);
+    }
+    std::ranges::sort(order);
+
+    std::vector<std::pair<int, int>> cells;
+    for (const auto &[unknown, id] : order) {
+      const bool isRow = id < n;
+      const int line = isRow ? id : id - n;
+      const BitLine filled = isRow ? st.filled.row(line) : st.filled.col(line);
+      const BitLine blanks = isRow ? st.empty.row(line) : st.empty.col(line);
+      for (int k = 0; k < n && cells.size() < limit; ++k) {
+        if (!filled[k] && !blanks[k])
+          cells.push_back(isRow ? std::pair{line, k} : std::pair{k, line});
+      }
+      if (cells.size() >= limit)
+        break;
+    }
+    return cells;
+  }
+
+  // Probes cells of the most constrained lines: each is set both ways and
+  // propagated. A side that contradicts fixes the cell to the other value;
+  // otherwise the cell whose weaker side still decides the most cells is
+  // kept as the branch, with both sides already propagated. Returns false
+  // when some cell contradicts both ways or time runs out.
+  bool probe(State &st, State &fillSide, State &emptySide,
+             LineSolver &solver) {
+    while (true) {
+      bool forced = false;
+      int bestGain = -1;
+      for (const auto &[r, c] : probe_cells(st, kProbeCells)) {
+        if (out_of_time())
+          return false;
+        if (st.filled.test(r, c) || st.empty.test(r, c))
+          continue; // decided by an earlier probe this round
+        const std::vector<int> touched{r, n + c};
+        State a = st;
+        a.filled.set(r, c, true);
+        ++a.known;
+        const bool fillOk = propagate(a, touched, solver);
+        State b = st;
+        b.empty.set(r, c, true);
+        ++b.known;
+        const bool emptyOk = propagate(b, touched, solver);
+
+        if (!fillOk && !emptyOk)
+          return false;
+        if (!fillOk || !emptyOk) {
+          st = fillOk ? std::move(a) : std::move(b);
+          forced = true;
+          if (st.known == n * n)
+            return true;
+          continue;
+        }
+        const int gain = std::min(a.known, b.known) - st.known;
+        if (!forced && gain > bestGain) {
+          bestGain = gain;
+          fillSide = std::move(a);
+          emptySide = std::move(b);
+        }
+      }
+      // Branch sides found before a forced cell are stale, so go again
+      if (!forced)
+        return true;
+    }
+  }
+
+  void record(const BitBoard &solution) {
+    std::lock_guard lock(result_mutex);
+    if (solutions.size() < 2)
+      solutions.push_back(solution);
+    ++found;
+  }
+
+  void spawn(State st, std::vector<int> seeds, int depth) {
+    {
+      std::lock_guard lock(wait_mutex);
+      ++pending;
+    }
+    pool->submit([this, st = std::move(st), seeds = std::move(seeds),
+                  depth]() mutable {
+      explore(std::move(st), seeds, depth);
+      std::lock_guard lock(wait_mutex);
+      if (--pending == 0)
+        idle.notify_all();
+    });
+  }
+
+  void explore(State st, const std::vector<int> &seeds, int depth) {
+    if (stopped())
+      return;
+
+    thread_local LineSolver solver;
+    if (!propagate(st, seeds, solver))
+      return;
+    if (st.known < n * n) {
+      if (out_of_time())
+        return;
+      ++branches;
+      guessed = true;
+    }
+
+    State fillSide;
+    State emptySide;
+    if (st.known < n * n && !probe(st, fillSide, emptySide, solver))
+      return;
+    if (st.known == n * n) {
+      record(st.filled);
+      return;
+    }
+
+    // Both sides are already propagated, so they start with nothing queued
+    if (pool && depth < kSpawnDepth) {
+      spawn(std::move(emptySide), {}, depth + 1);
+      explore(std::move(fillSide), {}, depth + 1);
+    } else {
+      explore(std::move(fillSide), {}, depth + 1);
+      explore(std::move(emptySide), {}, depth + 1);
+    }
+  }
+
+public:
+  Search(const PicrossHints &h, int size, std::chrono::milliseconds budget,
+         ThreadPool *p)
+      : hints(h), n(size),
+        deadline(std::chrono::steady_clock::now() + budget), pool(p) {}
+
+  SolveResult run() {
+    std::vector<int> all(2 * static_cast<std::size_t>(n));
+    for (int id = 0; id < 2 * n; ++id)
+      all[id] = id;
+    explore(State{BitBoard(n), BitBoard(n), 0}, all, 0);
+
+    std::unique_lock lock(wait_mutex);
+    idle.wait(lock, [this] { return pending == 0; });
+
+    SolveResult result;
+    result.solutions = std::move(solutions);
+    result.branches = branches;
+    result.needed_guessing = guessed;
+    if (found >= 2)
+      result.status = SolveStatus::Multiple;
+    else if (gave_up)
+      result.status = SolveStatus::GaveUp;
+    else
+      result.status = found == 1 ? SolveStatus::Unique : SolveStatus::NoSolution;
+    return result;
+  }
+};
+} // namespace
+
+PuzzleSolver::PuzzleSolver(const PicrossHints &h,
+                           std::chrono::milliseconds timeBudget)
+    : hints(h), n(h.get_row_count()), budget(timeBudget) {
+  if (h.get_row_count() != h.get_col_count()) {
+    throw InvalidGridException(
+        "Solver needs a square puzzle, got " +
+        std::to_string(h.get_row_count()) + "x" +
+        std::to_string(h.get_col_count()));
+  }
+}
+
+bool PuzzleSolver::propagate(const PicrossHints &hints, BitBoard &filled,
+                             BitBoard &empty, int &known,
+                             std::span<const int> lines, LineSolver &solver) {
+  const int n = filled.size();
+  std::vector<std::uint8_t> queued(2 * static_cast<std::size_t>(n), 0);
+  std::deque<int> queue;
+  for (int id : lines) {
+    if (!queued[id]) {
+      queued[id] = 1;
+      queue.push_back(id);
+    }
+  }
+
+  while (!queue.empty()) {
+    const int id = queue.front();
+    queue.pop_front();
+    queued[id] = 0;
+    const bool isRow = id < n;
+    const int line = isRow ? id : id - n;
+    if (!solver.solve_line(hints, filled, empty, isRow, line))
+      return false;
+
+    const auto forcedFilled = solver.forced_filled();
+    const auto forcedEmpty = solver.forced_empty();
+    for (std::size_t w = 0; w < forcedFilled.size(); ++w) {
+      const BitLine cells = isRow ? filled.row(line) : filled.col(line);
+      const BitLine blanks = isRow ? empty.row(line) : empty.col(line);
+      const std::uint64_t newFilled = forcedFilled[w] & ~cells.words()[w];
+      const std::uint64_t newEmpty = forcedEmpty[w] & ~blanks.words()[w];
+
+      for (int pass = 0; pass < 2; ++pass) {
+        std::uint64_t bits = pass == 0 ? newFilled : newEmpty;
+        BitBoard &board = pass == 0 ? filled : empty;
+        while (bits) {
+          const int k = static_cast<int>(w) * 64 + std::countr_zero(bits);
+          bits &= bits - 1;
+          if (isRow)
+            board.set(line, k, true);
+          else
+            board.set(k, line, true);
+          ++known;
+
+          // Only the crossing line of a changed cell can learn more
+          const int crossing = isRow ? n + k : k;
+          if (!queued[crossing]) {
+            queued[crossing] = 1;
+            queue.push_back(crossing);
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+SolveResult PuzzleSolver::solve(ThreadPool *pool) const {
+  return Search(hints, n, budget, pool).run();
+}
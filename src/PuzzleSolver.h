@@ -0,0 +1,66 @@
+#ifndef OOP_PUZZLESOLVER_H
+#define OOP_PUZZLESOLVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BitBoard.h"
+#include "PicrossHints.h"
+
+class LineSolver;
+class ThreadPool;
+
+enum class SolveStatus {
+  NoSolution, // the clues contradict each other
+  Unique,
+  Multiple,
+  GaveUp // time budget ran out before the answer was known
+};
+
+struct SolveResult {
+  SolveStatus status = SolveStatus::NoSolution;
+  std::vector<BitBoard> solutions; // up to two, enough to show ambiguity
+  bool needed_guessing = false;    // false if line logic alone solved it
+  long branches = 0;
+};
+
+// Whole-puzzle solver for square boards. Runs line propagation with a work
+// queue (a line is re-solved only after one of its cells changed). When
+// propagation stalls it probes cells of the most constrained lines, fixing
+// any cell whose other value leads to a contradiction, and then branches on
+// the probed cell that decides the most either way. One side of each of the
+// first few branches is handed to a thread pool; deeper ones are searched
+// on the thread that reached them. The search stops as soon as a second
+// solution turns up.
+//
+// The budget is wall-clock time, checked before every branch and probed
+// cell, so a hopeless search (e.g. random noise at 50% density) reports
+// GaveUp shortly after it runs out whatever the board size. Branches cost
+// anywhere from a fraction of a millisecond to a few on 50x50 and 100x100
+// boards, so a branch count could not promise that.
+class PuzzleSolver {
+  const PicrossHints &hints;
+  int n;
+  std::chrono::milliseconds budget;
+
+public:
+  static constexpr std::chrono::milliseconds kDefaultBudget{250};
+
+  explicit PuzzleSolver(const PicrossHints &hints,
+                        std::chrono::milliseconds budget = kDefaultBudget);
+
+  // With no pool the search runs on the calling thread.
+  [[nodiscard]] SolveResult solve(ThreadPool *pool = nullptr) const;
+
+  // Line logic alone: re-solves the given lines (rows are 0..n-1, columns
+  // n..2n-1) and every line crossing a cell they decide, until nothing
+  // changes. Decided cells are added to filled/empty and counted in known.
+  // Returns false if the clues contradict the cells.
+  static bool propagate(const PicrossHints &hints, BitBoard &filled,
+                        BitBoard &empty, int &known,
+                        std::span<const int> lines, LineSolver &solver);
+};
+
+#endif // OOP_PUZZLESOLVER_H
@@ -0,0 +1,91 @@
+#include "ResourceCache.h"
+#include "Exceptions.h"
+
+#include <unordered_map>
+#include <utility>
+
+namespace {
+bool readFile(sf::Texture &texture, const std::string &path) {
+  return texture.loadFromFile(path);
+}
+
+bool readFile(sf::Font &font, const std::string &path) {
+  return font.openFromFile(path);
+}
+
+bool readFile(sf::SoundBuffer &buffer, const std::string &path) {
+  return buffer.loadFromFile(path);
+}
+
+template <typename Table> std::size_t dropUnused(Table &table) {
+  return std::erase_if(table,
+                       [](const auto &entry) { return entry.second.use_count() == 1; });
+}
+} // namespace
+
+template <typename T>
+std::shared_ptr<T> ResourceCache::load(Table<T> &table,
+                                       const std::string &path) {
+  if (const auto it = table.find(path); it != table.end()) {
+    ++stats.hits;
+    return it->second;
+  }
+  ++stats.misses;
+  auto resource = std::make_shared<T>();
+  if (!readFile(*resource, path))
+    return nullptr;
+  return table.emplace(path, std::move(resource)).first->second;
+}
+
+std::shared_ptr<const sf::Texture> ResourceCache::texture(const std::string &path,
+                                                          bool repeated) {
+  auto texture = load(textures, path);
+  if (!texture) {
+    throw AssetLoadException(path, "Texture");
+  }
+  if (repeated) {
+    texture->setRepeated(true);
+  }
+  return texture;
+}
+
+std::shared_ptr<const sf::Font> ResourceCache::font(const std::string &path) {
+  auto font = load(fonts, path);
+  if (!font) {
+    throw AssetLoadException(path, "Font");
+  }
+  return font;
+}
+
+std::shared_ptr<const sf::SoundBuffer>
+ResourceCache::soundBuffer(const std::string &path) {
+  auto buffer = load(soundBuffers, path);
+  if (!buffer) {
+    throw AssetLoadException(path, "Sound");
+  }
+  return buffer;
+}
+
+std::shared_ptr<const sf::SoundBuffer>
+ResourceCache::optionalSoundBuffer(const std::string &path) {
+  return load(soundBuffers, path);
+}
+
+void ResourceCache::add(const std::string &path,
+                        std::shared_ptr<sf::Texture> texture) {
+  textures.try_emplace(path, std::move(texture));
+}
+
+void ResourceCache::add(const std::string &path,
+                        std::shared_ptr<sf::SoundBuffer> buffer) {
+  soundBuffers.try_emplace(path, std::move(buffer));
+}
+
+std::size_t ResourceCache::trim() {
+  return dropUnused(textures) + dropUnused(fonts) + dropUnused(soundBuffers);
+}
+
+ResourceCache &ResourceCache::shared() {
+  static ResourceCache cache;
+  return cache;
+}
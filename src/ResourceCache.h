@@ -0,0 +1,77 @@
+#ifndef OOP_RESOURCECACHE_H
+#define OOP_RESOURCECACHE_H
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Textures, fonts and sound buffers shared by file path. The first request
+// for a path decodes the file; later ones get the same object back. The
+// cache keeps its own reference, so screens and modes that are torn down
+// and rebuilt (a new game, a new mode) find their files still decoded;
+// trim() lets go of whatever nobody else holds any more.
+class ResourceCache {
+public:
+  struct Stats {
+    std::size_t hits = 0;   // requests served from memory
+    std::size_t misses = 0; // requests that read a file
+  };
+
+private:
+  template <typename T>
+  using Table = std::unordered_map<std::string, std::shared_ptr<T>>;
+
+  Table<sf::Texture> textures;
+  Table<sf::Font> fonts;
+  Table<sf::SoundBuffer> soundBuffers;
+  Stats stats;
+
+  // The cached entry, or the file freshly read and cached; nullptr if it
+  // cannot be read.
+  template <typename T>
+  std::shared_ptr<T> load(Table<T> &table, const std::string &path);
+
+public:
+  ResourceCache() = default;
+  ResourceCache(const ResourceCache &) = delete;
+  ResourceCache &operator=(const ResourceCache &) = delete;
+
+  // Each throws AssetLoadException if the file cannot be read. A texture
+  // asked for as repeated stays repeated for everyone sharing it.
+  std::shared_ptr<const sf::Texture> texture(const std::string &path,
+                                             bool repeated = false);
+  std::shared_ptr<const sf::Font> font(const std::string &path);
+  std::shared_ptr<const sf::SoundBuffer> soundBuffer(const std::string &path);
+
+  // For sounds a mode can do without: nullptr instead of an exception.
+  // Failures are not remembered, so a file that appears later is found.
+  std::shared_ptr<const sf::SoundBuffer>
+  optionalSoundBuffer(const std::string &path);
+
+  // Hands over a file decoded elsewhere (see AssetLoader). If the path is
+  // already cached, the cached entry is kept.
+  void add(const std::string &path, std::shared_ptr<sf::Texture> texture);
+  void add(const std::string &path, std::shared_ptr<sf::SoundBuffer> buffer);
+
+  // Drops every entry only the cache still refers to; returns how many.
+  std::size_t trim();
+
+  // Whether any kind of resource is cached for path.
+  [[nodiscard]] bool contains(const std::string &path) const {
+    return textures.contains(path) || fonts.contains(path) ||
+           soundBuffers.contains(path);
+  }
+
+  [[nodiscard]] Stats getStats() const { return stats; }
+  [[nodiscard]] std::size_t size() const {
+    return textures.size() + fonts.size() + soundBuffers.size();
+  }
+
+  // The game's shared cache.
+  static ResourceCache &shared();
+};
+
+#endif // OOP_RESOURCECACHE_H
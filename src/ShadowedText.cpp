@@ -1,32 +1,169 @@
 #include "ShadowedText.h"
+#include <algorithm>
 #include <cmath>
+#include <utility>
 
-void ShadowedText::draw(sf::RenderWindow &window, const sf::Text &text,
-                        const sf::Vector2f &position, float scale) {
-  sf::Text shadow(text.getFont(), text.getString());
-  shadow.setCharacterSize(text.getCharacterSize());
-  shadow.setFillColor(sf::Color(0, 0, 0, 170));
-  shadow.setRotation(text.getRotation());
-  shadow.setOrigin(text.getOrigin());
-  shadow.setScale(text.getScale());
-
-  sf::Vector2f shadowOffset(std::round(2.0f * scale), std::round(2.0f * scale));
-  sf::Vector2f snappedPos(std::round(position.x), std::round(position.y));
-
-  shadow.setPosition(snappedPos + shadowOffset);
-  window.draw(shadow);
-
-  sf::Text mainText(text.getFont(), text.getString());
-  mainText.setCharacterSize(text.getCharacterSize());
-  mainText.setFillColor(text.getFillColor());
-  mainText.setRotation(text.getRotation());
-  mainText.setOrigin(text.getOrigin());
-  mainText.setScale(text.getScale());
-  mainText.setPosition(snappedPos);
-  window.draw(mainText);
-}
-
-void ShadowedText::draw(sf::RenderWindow &window, const sf::Text &text,
-                        float scale) {
-  draw(window, text, text.getPosition(), scale);
+namespace {
+const sf::Color kShadowColor(0, 0, 0, 170);
+
+// sf::Text pads every glyph quad by a pixel so anti-aliased edges survive
+constexpr float kGlyphPadding = 1.f;
+
+void appendGlyph(sf::VertexArray &vertices, sf::Vector2f pen,
+                 const sf::Glyph &glyph, sf::Color color) {
+  const sf::Vector2f topLeft =
+      pen + glyph.bounds.position - sf::Vector2f{kGlyphPadding, kGlyphPadding};
+  const sf::Vector2f bottomRight = pen + glyph.bounds.position +
+                                   glyph.bounds.size +
+                                   sf::Vector2f{kGlyphPadding, kGlyphPadding};
+  const sf::Vector2f uv1 = sf::Vector2f(glyph.textureRect.position) -
+                           sf::Vector2f{kGlyphPadding, kGlyphPadding};
+  const sf::Vector2f uv2 =
+      sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) +
+      sf::Vector2f{kGlyphPadding, kGlyphPadding};
+
+  vertices.append({topLeft, color, uv1});
+  vertices.append({{bottomRight.x, topLeft.y}, color, {uv2.x, uv1.y}});
+  vertices.append({{topLeft.x, bottomRight.y}, color, {uv1.x, uv2.y}});
+  vertices.append({{topLeft.x, bottomRight.y}, color, {uv1.x, uv2.y}});
+  vertices.append({{bottomRight.x, topLeft.y}, color, {uv2.x, uv1.y}});
+  vertices.append({bottomRight, color, uv2});
+}
+} // namespace
+
+ShadowedText::ShadowedText(const sf::Font &font, sf::String string,
+                           unsigned characterSize)
+    : font(&font), string(std::move(string)), characterSize(characterSize) {}
+
+void ShadowedText::setFont(const sf::Font &newFont) {
+  if (font != &newFont) {
+    font = &newFont;
+    geometryDirty = true;
+  }
+}
+
+void ShadowedText::setString(const sf::String &newString) {
+  if (string != newString) {
+    string = newString;
+    geometryDirty = true;
+  }
+}
+
+void ShadowedText::setCharacterSize(unsigned size) {
+  if (characterSize != size) {
+    characterSize = size;
+    geometryDirty = true;
+  }
+}
+
+void ShadowedText::setFillColor(sf::Color color) {
+  if (fillColor == color)
+    return;
+  fillColor = color;
+  if (geometryDirty)
+    return;
+  for (std::size_t i = glyphVertices; i < vertices.getVertexCount(); ++i)
+    vertices[i].color = color;
+}
+
+sf::FloatRect ShadowedText::getLocalBounds() const {
+  ensureGeometry();
+  return bounds;
+}
+
+sf::FloatRect ShadowedText::getGlobalBounds() const {
+  return getTransform().transformRect(getLocalBounds());
+}
+
+void ShadowedText::ensureGeometry() const {
+  if (!geometryDirty)
+    return;
+  geometryDirty = false;
+  vertices.clear();
+  bounds = {};
+  glyphVertices = 0;
+  shadowShift = {};
+  if (string.isEmpty())
+    return;
+
+  // Same pen walk as sf::Text: the first baseline sits one character size
+  // below the origin, whitespace only moves the pen.
+  const auto size = static_cast<float>(characterSize);
+  const float whitespaceWidth = font->getGlyph(U' ', characterSize, false).advance;
+  const float lineSpacing = font->getLineSpacing(characterSize);
+  float x = 0.f;
+  float y = size;
+  float minX = size;
+  float minY = size;
+  float maxX = 0.f;
+  float maxY = 0.f;
+  char32_t previous = 0;
+
+  for (const char32_t current : string) {
+    if (current == U'\r')
+      continue;
+    x += font->getKerning(previous, current, characterSize);
+    previous = current;
+
+    if (current == U' ' || current == U'\n' || current == U'\t') {
+      minX = std::min(minX, x);
+      minY = std::min(minY, y);
+      if (current == U' ') {
+        x += whitespaceWidth;
+      } else if (current == U'\t') {
+        x += whitespaceWidth * 4;
+      } else {
+        y += lineSpacing;
+        x = 0.f;
+      }
+      maxX = std::max(maxX, x);
+      maxY = std::max(maxY, y);
+      continue;
+    }
+
+    const sf::Glyph &glyph = font->getGlyph(current, characterSize, false);
+    appendGlyph(vertices, {x, y}, glyph, fillColor);
+    minX = std::min(minX, x + glyph.bounds.position.x);
+    maxX = std::max(maxX, x + glyph.bounds.position.x + glyph.bounds.size.x);
+    minY = std::min(minY, y + glyph.bounds.position.y);
+    maxY = std::max(maxY, y + glyph.bounds.position.y + glyph.bounds.size.y);
+    x += glyph.advance;
+  }
+  bounds = {{minX, minY}, {maxX - minX, maxY - minY}};
+
+  // Duplicate the quads in front as the shadow pass; draw() shifts them
+  glyphVertices = vertices.getVertexCount();
+  vertices.resize(glyphVertices * 2);
+  for (std::size_t i = 0; i < glyphVertices; ++i) {
+    vertices[glyphVertices + i] = vertices[i];
+    vertices[i].color = kShadowColor;
+  }
+}
+
+void ShadowedText::draw(sf::RenderTarget &target,
+                        sf::RenderStates states) const {
+  ensureGeometry();
+  if (glyphVertices == 0)
+    return;
+
+  sf::Transformable snapped(*this);
+  const sf::Vector2f position = getPosition();
+  snapped.setPosition({std::round(position.x), std::round(position.y)});
+  const sf::Transform transform = snapped.getTransform();
+
+  // The shadow offset is in window pixels; undo scale and rotation to find
+  // it in glyph space, and move the shadow quads only when that changed.
+  const float offset = std::round(2.0f * shadowScale);
+  const sf::Transform inverse = transform.getInverse();
+  const sf::Vector2f shift = inverse.transformPoint({offset, offset}) -
+                             inverse.transformPoint({0.f, 0.f});
+  if (shift != shadowShift) {
+    shadowShift = shift;
+    for (std::size_t i = 0; i < glyphVertices; ++i)
+      vertices[i].position = vertices[glyphVertices + i].position + shift;
+  }
+
+  states.transform *= transform;
+  states.texture = &font->getTexture(characterSize);
+  target.draw(vertices, states);
 }
@@ -2,13 +2,54 @@
 #define OOP_SHADOWEDTEXT_H
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+
+// Text with a drop shadow, kept between frames. The glyphs are laid out
+// into one vertex array, shadow quads first and the text on top, and drawn
+// with a single call. Layout is redone only when the string, font or
+// character size changes; a new fill colour, shadow scale or transform
+// just patches or reuses the existing vertices.
+//
+// Measured and positioned like sf::Text: getLocalBounds() matches and the
+// drawn position is snapped to whole pixels.
+class ShadowedText : public sf::Drawable, public sf::Transformable {
+  const sf::Font *font;
+  sf::String string;
+  unsigned characterSize;
+  sf::Color fillColor = sf::Color::White;
+  float shadowScale = 1.f;
+
+  mutable sf::VertexArray vertices{sf::PrimitiveType::Triangles};
+  mutable sf::FloatRect bounds;
+  mutable std::size_t glyphVertices = 0; // per pass
+  mutable sf::Vector2f shadowShift;      // shadow offset baked into vertices
+  mutable bool geometryDirty = true;
+
+  void ensureGeometry() const;
+  void draw(sf::RenderTarget &target, sf::RenderStates states) const override;
 
-class ShadowedText {
 public:
-  static void draw(sf::RenderWindow &window, const sf::Text &text,
-                   const sf::Vector2f &position, float scale);
+  explicit ShadowedText(const sf::Font &font, sf::String string = "",
+                        unsigned characterSize = 30);
+
+  void setFont(const sf::Font &newFont);
+  void setString(const sf::String &newString);
+  void setCharacterSize(unsigned size);
+  void setFillColor(sf::Color color);
+
+  // UI scale the shadow is sized for; it falls round(2 * scale) window
+  // pixels below and right of the text whatever the text's transform.
+  void setShadowScale(float scale) { shadowScale = scale; }
+
+  [[nodiscard]] const sf::Font &getFont() const { return *font; }
+  [[nodiscard]] const sf::String &getString() const { return string; }
+  [[nodiscard]] unsigned getCharacterSize() const { return characterSize; }
+  [[nodiscard]] sf::Color getFillColor() const { return fillColor; }
+  [[nodiscard]] float getShadowScale() const { return shadowScale; }
 
-  static void draw(sf::RenderWindow &window, const sf::Text &text, float scale);
+  // Same as sf::Text::getLocalBounds(); the shadow is not included.
+  [[nodiscard]] sf::FloatRect getLocalBounds() const;
+  [[nodiscard]] sf::FloatRect getGlobalBounds() const;
 };
 
 #endif // OOP_SHADOWEDTEXT_H
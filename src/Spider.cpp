@@ -22,8 +22,9 @@ void Spider::updateRotation() {
 Spider::Spider(sf::Vector2f startPos, const sf::Texture &walkTex,
                const sf::Texture &idleTex, const sf::Texture &deathTex,
                const sf::SoundBuffer *deathSnd,
-               const std::vector<sf::SoundBuffer> *idleSnds,
-               const std::vector<sf::SoundBuffer> *stepSnds, float scale)
+               const std::vector<std::shared_ptr<const sf::SoundBuffer>> *idleSnds,
+               const std::vector<std::shared_ptr<const sf::SoundBuffer>> *stepSnds,
+               float scale)
     : sprite(walkTex), walkTexture(&walkTex), idleTexture(&idleTex),
       deathTexture(&deathTex),
       state(State::Walking), velocity(0.f, 0.f), stateTimer(randomFloat(2.0f, 5.0f)), scale(scale),
@@ -69,7 +70,7 @@ void Spider::changeState(State newState) {
       std::uniform_int_distribution<> dis(0, static_cast<int>(stepSoundBuffers->size()) - 1);
       
       currentStepSoundIndex = dis(gen);
-      audioSource.emplace((*stepSoundBuffers)[currentStepSoundIndex]);
+      audioSource.emplace(*(*stepSoundBuffers)[currentStepSoundIndex]);
       audioSource->setVolume(currentVolume);
       audioSource->play();
 
@@ -205,7 +206,7 @@ void Spider::update(float dt, const sf::Vector2u &windowSize) {
               std::uniform_real_distribution<float> timeDis(1.5f, 3.0f); // "Rarer" - delay between steps
               
               currentStepSoundIndex = dis(gen);
-              audioSource.emplace((*stepSoundBuffers)[currentStepSoundIndex]);
+              audioSource.emplace(*(*stepSoundBuffers)[currentStepSoundIndex]);
               audioSource->setVolume(currentVolume);
               audioSource->play();
               
@@ -221,7 +222,7 @@ void Spider::update(float dt, const sf::Vector2u &windowSize) {
           if (dis(gen) == 0) {
              std::uniform_int_distribution<> idxDis(0, static_cast<int>(idleSoundBuffers->size()) - 1);
              int idx = idxDis(gen);
-             audioSource.emplace((*idleSoundBuffers)[idx]);
+             audioSource.emplace(*(*idleSoundBuffers)[idx]);
              audioSource->setVolume(currentVolume);
              audioSource->play();
           }
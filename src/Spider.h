@@ -3,6 +3,9 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
 
 class Spider {
 public:
@@ -11,8 +14,9 @@ public:
   Spider(sf::Vector2f startPos, const sf::Texture &walkTex,
          const sf::Texture &idleTex, const sf::Texture &deathTex,
          const sf::SoundBuffer *deathSnd,
-         const std::vector<sf::SoundBuffer> *idleSnds,
-         const std::vector<sf::SoundBuffer> *stepSnds, float scale = 0.3f);
+         const std::vector<std::shared_ptr<const sf::SoundBuffer>> *idleSnds,
+         const std::vector<std::shared_ptr<const sf::SoundBuffer>> *stepSnds,
+         float scale = 0.3f);
 
   void update(float dt, const sf::Vector2u &windowSize);
 
@@ -69,8 +73,8 @@ private:
   void updateRotation();
 
   const sf::SoundBuffer *deathSoundBuffer;
-  const std::vector<sf::SoundBuffer> *idleSoundBuffers;
-  const std::vector<sf::SoundBuffer> *stepSoundBuffers;
+  const std::vector<std::shared_ptr<const sf::SoundBuffer>> *idleSoundBuffers;
+  const std::vector<std::shared_ptr<const sf::SoundBuffer>> *stepSoundBuffers;
   std::optional<sf::Sound> audioSource;
   int currentStepSoundIndex = 0;
   float idleSoundTimer = 0.0f;
@@ -1,6 +1,8 @@
 #include "SpidersMode.h"
 #include "AlchemyMode.h"
-#include "Exceptions.h"
+#include "AssetLoader.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
 #include "Grid.h"
 #include "GridRenderer.h"
 #include <algorithm>
@@ -23,79 +25,74 @@ static int getRandomEdge() {
   return dis(gen);
 }
 
+namespace {
+constexpr const char *kWalkTexture = "assets/enemy/spider_walk.png";
+constexpr const char *kIdleTexture = "assets/enemy/spider_idle.png";
+constexpr const char *kDeathTexture = "assets/enemy/spider_death.png";
+constexpr const char *kDeathSound = "assets/sound/Spider_death.ogg";
+constexpr const char *kBrokenWebSound = "assets/sound/break.ogg";
+
+std::string idleSound(int i) {
+  return "assets/sound/Spider_idle" + std::to_string(i) + ".ogg";
+}
+std::string stepSound(int i) {
+  return "assets/sound/Spider_step" + std::to_string(i) + ".ogg";
+}
+std::string hitWebSound(int i) {
+  return "assets/sound/Stone_hit" + std::to_string(i) + ".ogg";
+}
+} // namespace
+
 // SpidersMode Implementation
 SpidersMode::SpidersMode(std::unique_ptr<GameMode> mode)
     : GameModeDecorator(std::move(mode)), spawnTimer(0.0f), damageTimer(0.0f) {
   std::filesystem::path cwd = std::filesystem::current_path();
   std::cout << "Current working directory: " << cwd << std::endl;
 
-  if (!walkTexture.loadFromFile("assets/enemy/spider_walk.png")) {
-    throw AssetLoadException("assets/enemy/spider_walk.png", "Texture");
-  }
-  if (!idleTexture.loadFromFile("assets/enemy/spider_idle.png")) {
-    throw AssetLoadException("assets/enemy/spider_idle.png", "Texture");
-  }
-  if (!deathTexture.loadFromFile("assets/enemy/spider_death.png")) {
-    throw AssetLoadException("assets/enemy/spider_death.png", "Texture");
-  }
-
-  if (!deathBuffer.loadFromFile("assets/sound/Spider_death.ogg")) {
-    throw AssetLoadException("assets/sound/Spider_death.ogg", "Sound");
+  // Death particle frames
+  const TextureAtlas &atlas = TextureAtlas::game();
+  for (int i = 0; i <= 7; ++i) {
+      deathPoofSystem.addFrame(atlas.region("particle/generic_" + std::to_string(i)));
   }
+}
 
-  idleBuffers.reserve(4);
+void SpidersMode::prefetch(AssetLoader &loader) {
+  for (const char *path : {kWalkTexture, kIdleTexture, kDeathTexture})
+    loader.addTexture(path);
+  loader.addSoundBuffer(kDeathSound);
+  loader.addSoundBuffer(kBrokenWebSound);
   for (int i = 1; i <= 4; ++i) {
-    sf::SoundBuffer buf;
-    if (buf.loadFromFile("assets/sound/Spider_idle" + std::to_string(i) +
-                         ".ogg")) {
-      idleBuffers.push_back(buf);
-    } else {
-      throw AssetLoadException(
-          "assets/sound/Spider_idle" + std::to_string(i) + ".ogg", "Sound");
-    }
+    loader.addSoundBuffer(idleSound(i));
+    loader.addSoundBuffer(stepSound(i));
   }
+  for (int i = 1; i <= 5; ++i)
+    loader.addSoundBuffer(hitWebSound(i));
+}
 
+void SpidersMode::loadAssets() {
+  if (walkTexture)
+    return;
+
+  ResourceCache &cache = ResourceCache::shared();
+  walkTexture = cache.texture(kWalkTexture);
+  idleTexture = cache.texture(kIdleTexture);
+  deathTexture = cache.texture(kDeathTexture);
+
+  deathBuffer = cache.soundBuffer(kDeathSound);
+
+  idleBuffers.reserve(4);
   stepBuffers.reserve(4);
   for (int i = 1; i <= 4; ++i) {
-    sf::SoundBuffer buf;
-    if (buf.loadFromFile("assets/sound/Spider_step" + std::to_string(i) +
-                         ".ogg")) {
-      stepBuffers.push_back(buf);
-    } else {
-      throw AssetLoadException(
-          "assets/sound/Spider_step" + std::to_string(i) + ".ogg", "Sound");
-    }
+    idleBuffers.push_back(cache.soundBuffer(idleSound(i)));
+    stepBuffers.push_back(cache.soundBuffer(stepSound(i)));
   }
 
   // Web sounds
-  if (!brokenWebBuffer.loadFromFile("assets/sound/break.ogg")) {
-    throw AssetLoadException("assets/sound/break.ogg", "Sound");
-  }
+  brokenWebBuffer = cache.soundBuffer(kBrokenWebSound);
 
   hitWebBuffers.reserve(5);
-  for (int i = 1; i <= 5; ++i) {
-    sf::SoundBuffer buf;
-    if (buf.loadFromFile("assets/sound/Stone_hit" + std::to_string(i) +
-                         ".ogg")) {
-      hitWebBuffers.push_back(buf);
-    } else {
-      throw AssetLoadException(
-          "assets/sound/Stone_hit" + std::to_string(i) + ".ogg", "Sound");
-    }
-  }
-
-  // Load death particles
-  deathPoofTextures.reserve(8);
-  for (int i = 0; i <= 7; ++i) {
-      sf::Texture tex;
-      if (tex.loadFromFile("assets/particle/generic_" + std::to_string(i) + ".png")) {
-          deathPoofTextures.push_back(std::move(tex));
-      }
-  }
-  
-  for(const auto& t : deathPoofTextures) {
-      deathPoofSystem.addTexture(&t);
-  }
+  for (int i = 1; i <= 5; ++i)
+    hitWebBuffers.push_back(cache.soundBuffer(hitWebSound(i)));
 }
 
 void SpidersMode::setGrid(Grid *g) {
@@ -212,8 +209,8 @@ void SpidersMode::update(float deltaTime) {
         // Use last known mouse position
         Grid::WebDamageResult result = renderer->handleHintClick(lastMousePos);
 
-        if (result == Grid::WebDamageResult::Destroyed) {
-          webAudioSource.emplace(brokenWebBuffer);
+        if (result == Grid::WebDamageResult::Destroyed && brokenWebBuffer) {
+          webAudioSource.emplace(*brokenWebBuffer);
           webAudioSource->setVolume(currentVolume);
           webAudioSource->play();
         } else if (result == Grid::WebDamageResult::Damaged) {
@@ -224,7 +221,7 @@ void SpidersMode::update(float deltaTime) {
 
             // Play random stone hit
             int hitIdx = dis(gen);
-            webAudioSource.emplace(hitWebBuffers[hitIdx]);
+            webAudioSource.emplace(*hitWebBuffers[hitIdx]);
             webAudioSource->setVolume(currentVolume);
             webAudioSource->play();
           }
@@ -312,6 +309,7 @@ bool SpidersMode::handleInput(const sf::Event &event,
 }
 
 void SpidersMode::spawnSpider() {
+  loadAssets();
   if (windowSize.x == 0)
     windowSize = {1280, 720};
 
@@ -349,8 +347,8 @@ void SpidersMode::spawnSpider() {
     break;
   }
 
-  Spider newSpider(sf::Vector2f(x, y), walkTexture, idleTexture, deathTexture,
-                   &deathBuffer, &idleBuffers, &stepBuffers, spiderScale);
+  Spider newSpider(sf::Vector2f(x, y), *walkTexture, *idleTexture, *deathTexture,
+                   deathBuffer.get(), &idleBuffers, &stepBuffers, spiderScale);
   newSpider.setVolume(currentVolume);
   
   // Set health based on Weakness effect
@@ -376,13 +374,13 @@ void SpidersMode::spawnSpider() {
   if (grid && renderer) {
     // Pick random hint
     const auto &hints = grid->get_hints();
-    const auto &rowHints = hints.get_row_hints();
-    const auto &colHints = hints.get_col_hints();
+    const int rowCount = hints.get_row_count();
+    const int colCount = hints.get_col_count();
 
     bool pickRow = randomFloat(1) > 0.5f; // Changed from randomFloat(0, 1)
-    if (rowHints.empty())
+    if (rowCount == 0)
       pickRow = false;
-    if (colHints.empty() && !pickRow)
+    if (colCount == 0 && !pickRow)
       return;
 
     int line = -1;
@@ -393,20 +391,20 @@ void SpidersMode::spawnSpider() {
     while (attempts-- > 0) {
       if (pickRow) {
         line = static_cast<int>(
-            randomFloat(static_cast<float>(rowHints.size()) - 0.1f));
-        if (rowHints[line].empty())
+            randomFloat(static_cast<float>(rowCount) - 0.1f));
+        if (hints.get_row(line).empty())
           continue;
-        index = static_cast<int>(
-            randomFloat(static_cast<float>(rowHints[line].size()) - 0.1f));
+        index = static_cast<int>(randomFloat(
+            static_cast<float>(hints.get_row(line).size()) - 0.1f));
         if (!grid->isHintWebbed(true, line, index))
           break;
       } else {
         line = static_cast<int>(
-            randomFloat(static_cast<float>(colHints.size()) - 0.1f));
-        if (colHints[line].empty())
+            randomFloat(static_cast<float>(colCount) - 0.1f));
+        if (hints.get_col(line).empty())
           continue;
-        index = static_cast<int>(
-            randomFloat(static_cast<float>(colHints[line].size()) - 0.1f));
+        index = static_cast<int>(randomFloat(
+            static_cast<float>(hints.get_col(line).size()) - 0.1f));
         if (!grid->isHintWebbed(false, line, index))
           break;
       }
@@ -9,10 +9,16 @@
 #include "Spider.h"
 #include "ParticleTemplates.h"
 
+class AssetLoader;
+
 class SpidersMode : public GameModeDecorator {
 public:
     explicit SpidersMode(std::unique_ptr<GameMode> mode);
 
+    // Queues the spider sheets and sounds so the first spawn finds them
+    // cached.
+    static void prefetch(AssetLoader &loader);
+
     ~SpidersMode() override = default;
 
     void update(float deltaTime) override;
@@ -39,16 +45,16 @@ public:
 
 private:
     std::vector<Spider> spiders;
-    sf::Texture walkTexture;
-    sf::Texture idleTexture;
-    sf::Texture deathTexture;
+    std::shared_ptr<const sf::Texture> walkTexture;
+    std::shared_ptr<const sf::Texture> idleTexture;
+    std::shared_ptr<const sf::Texture> deathTexture;
 
-    sf::SoundBuffer deathBuffer;
-    std::vector<sf::SoundBuffer> idleBuffers;
-    std::vector<sf::SoundBuffer> stepBuffers;
+    std::shared_ptr<const sf::SoundBuffer> deathBuffer;
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> idleBuffers;
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> stepBuffers;
     
-    sf::SoundBuffer brokenWebBuffer;
-    std::vector<sf::SoundBuffer> hitWebBuffers;
+    std::shared_ptr<const sf::SoundBuffer> brokenWebBuffer;
+    std::vector<std::shared_ptr<const sf::SoundBuffer>> hitWebBuffers;
 
     std::optional<sf::Sound> webAudioSource;
 
@@ -64,9 +70,10 @@ private:
     bool wasWeaknessActive = false; // Track Weakness effect state
 
     // Death particles
-    std::vector<sf::Texture> deathPoofTextures;
     TemplateParticleSystem<DeathPoofTrait> deathPoofSystem;
 
+    // Spider sheets and sounds, fetched when the first spider spawns.
+    void loadAssets();
     void spawnSpider();
 };
 
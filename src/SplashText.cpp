@@ -1,15 +1,12 @@
 #include "SplashText.h"
 #include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
 #include <fstream>
 #include <random>
 
 SplashText::SplashText()
-    : font(), text(font), increasing(true), currentScale(1.0f), speed(0.3f) {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-  loadMessages();
+    : font(ResourceCache::shared().font("assets/Monocraft.ttf")), text(*font),
+      increasing(true), currentScale(1.0f), speed(0.3f) {  loadMessages();
   pickRandomMessage();
 }
 
@@ -38,9 +35,10 @@ void SplashText::pickRandomMessage() {
   std::uniform_int_distribution<size_t> dist(0, messages.size() - 1);
   std::string randomMessage = messages[dist(gen)];
 
-  text = sf::Text(font, randomMessage);
+  text.setString(randomMessage);
   text.setCharacterSize(30);
   text.setFillColor(sf::Color(213, 222, 82)); // Galben Minecraft
+  text.setRotation(sf::degrees(-20.0f));
 }
 
 void SplashText::update(float deltaTime) {
@@ -75,14 +73,15 @@ void SplashText::draw(sf::RenderWindow &window, const sf::Sprite &titleSprite,
   float splashX = logoX + logoWidth * 0.42f;
   float splashY = logoY + logoHeight * 0.05f;
 
-  float finalScale = scale * currentScale;
-  text.setCharacterSize(static_cast<unsigned int>(30.0f * finalScale));
-
-  text.setRotation(sf::degrees(-20.0f));
+  // The glyphs are laid out once per UI scale; the pulse only scales the
+  // transform, so it never re-lays out or re-rasterises the text.
+  text.setCharacterSize(static_cast<unsigned int>(30.0f * scale));
+  text.setScale({currentScale, currentScale});
+  text.setShadowScale(scale);
 
   auto bounds = text.getLocalBounds();
   text.setOrigin({bounds.size.x / 2.0f, bounds.size.y / 2.0f});
 
   text.setPosition({splashX, splashY});
-  ShadowedText::draw(window, text, scale);
+  window.draw(text);
 }
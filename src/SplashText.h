@@ -1,7 +1,9 @@
 #ifndef OOP_SPLASHTEXT_H
 #define OOP_SPLASHTEXT_H
 
+#include "ShadowedText.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,8 +21,8 @@ private:
   void loadMessages();
   void pickRandomMessage();
 
-  sf::Font font;
-  sf::Text text;
+  std::shared_ptr<const sf::Font> font;
+  ShadowedText text;
   std::vector<std::string> messages;
 
   bool increasing;
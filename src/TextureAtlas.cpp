@@ -0,0 +1,180 @@
+#include "TextureAtlas.h"
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+TextureAtlas::TextureAtlas(unsigned padding, unsigned pageSize)
+    : padding(padding), pageSize(pageSize) {}
+
+void TextureAtlas::add(const std::string &name,
+                       const std::filesystem::path &path) {
+  sf::Image image;
+  if (!image.loadFromFile(path)) {
+    throw AssetLoadException(path.string(), "Atlas Texture");
+  }
+  add(name, std::move(image));
+}
+
+void TextureAtlas::add(const std::string &name, sf::Image image) {
+  pending.push_back({name, std::move(image)});
+}
+
+void TextureAtlas::build() {
+  if (pending.empty())
+    return;
+
+  // Shelf packing, tallest images first so each shelf wastes little height
+  std::vector<std::size_t> order(pending.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::ranges::stable_sort(order, [this](std::size_t a, std::size_t b) {
+    return pending[a].image.getSize().y > pending[b].image.getSize().y;
+  });
+
+  struct Placement {
+    std::size_t page;
+    sf::Vector2u origin; // top-left of the padded cell
+  };
+  std::vector<Placement> placements(pending.size());
+  std::vector<unsigned> pageHeights;
+  const std::size_t firstPage = pages.size();
+  unsigned x = 0;
+  unsigned y = 0;
+  unsigned shelfHeight = 0;
+  pageHeights.push_back(0);
+
+  for (const std::size_t i : order) {
+    const sf::Vector2u size = pending[i].image.getSize();
+    const unsigned w = size.x + 2 * padding;
+    const unsigned h = size.y + 2 * padding;
+    if (w > pageSize || h > pageSize) {
+      throw AssetLoadException(pending[i].name, "Atlas Texture (too large)");
+    }
+    if (x + w > pageSize) {
+      y += shelfHeight;
+      x = 0;
+      shelfHeight = 0;
+    }
+    if (y + h > pageSize) {
+      pageHeights.push_back(0);
+      x = 0;
+      y = 0;
+      shelfHeight = 0;
+    }
+    placements[i] = {firstPage + pageHeights.size() - 1, {x, y}};
+    x += w;
+    shelfHeight = std::max(shelfHeight, h);
+    pageHeights.back() = std::max(pageHeights.back(), y + h);
+  }
+
+  std::vector<sf::Image> images;
+  for (const unsigned height : pageHeights)
+    images.emplace_back(sf::Vector2u{pageSize, std::bit_ceil(height)},
+                        sf::Color::Transparent);
+
+  for (std::size_t i = 0; i < pending.size(); ++i) {
+    const sf::Image &source = pending[i].image;
+    sf::Image &page = images[placements[i].page - firstPage];
+    const sf::Vector2u size = source.getSize();
+    const sf::Vector2u origin = placements[i].origin;
+
+    // Every padded pixel takes the colour of the nearest source pixel, which
+    // copies the image itself and extrudes its border into the padding.
+    for (unsigned py = 0; py < size.y + 2 * padding; ++py) {
+      const unsigned sy =
+          std::min(size.y - 1, py > padding ? py - padding : 0u);
+      for (unsigned px = 0; px < size.x + 2 * padding; ++px) {
+        const unsigned sx =
+            std::min(size.x - 1, px > padding ? px - padding : 0u);
+        page.setPixel({origin.x + px, origin.y + py},
+                      source.getPixel({sx, sy}));
+      }
+    }
+  }
+
+  for (const sf::Image &image : images) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->loadFromImage(image)) {
+      throw AssetLoadException("atlas page", "Atlas Texture");
+    }
+    pages.push_back(std::move(texture));
+  }
+
+  for (std::size_t i = 0; i < pending.size(); ++i) {
+    const sf::Vector2u size = pending[i].image.getSize();
+    const sf::Vector2u origin = placements[i].origin;
+    regions[pending[i].name] = {
+        pages[placements[i].page].get(),
+        sf::IntRect({static_cast<int>(origin.x + padding),
+                     static_cast<int>(origin.y + padding)},
+                    sf::Vector2i(size))};
+  }
+  pending.clear();
+}
+
+const AtlasRegion &TextureAtlas::region(const std::string &name) const {
+  const auto it = regions.find(name);
+  if (it == regions.end()) {
+    throw AssetLoadException(name, "Atlas Region");
+  }
+  return it->second;
+}
+
+const TextureAtlas &TextureAtlas::game() {
+  static const TextureAtlas atlas = [] {
+    TextureAtlas built;
+    for (const char *color :
+         {"black", "blue", "brown", "cyan", "gray", "green", "light_blue",
+          "light_gray", "lime", "magenta", "orange", "pink", "purple", "red",
+          "white", "yellow"}) {
+      const std::string name = std::string(color) + "_stained_glass";
+      built.add("glass/" + name, "assets/glass/" + name + ".png");
+    }
+    for (int i = 0; i <= 9; ++i) {
+      const std::string name = "destroy_stage_" + std::to_string(i);
+      built.add("break/" + name, "assets/break/" + name + ".png");
+    }
+    built.add("grid/slot", "assets/grid/slot.png");
+    built.add("grid/tab_hint", "assets/grid/tab_hint.png");
+    built.add("cobweb", "assets/cobweb.png");
+
+    for (const char *variant : {"", "poisoned_", "withered_"}) {
+      for (const char *fill : {"full", "half"}) {
+        for (const char *blink : {"", "_blinking"}) {
+          const std::string name =
+              std::string(variant) + "hardcore_" + fill + blink;
+          built.add("hearts/" + name, "assets/hearts/" + name + ".png");
+        }
+      }
+    }
+    built.add("hearts/container_hardcore",
+              "assets/hearts/container_hardcore.png");
+    built.add("hearts/container_hardcore_blinking",
+              "assets/hearts/container_hardcore_blinking.png");
+
+    for (const char *name :
+         {"food_empty", "food_empty_hunger", "food_full", "food_full_hunger",
+          "food_half", "food_half_hunger"}) {
+      built.add(std::string("hunger/") + name,
+                "assets/hunger/" + std::string(name) + ".png");
+    }
+
+    // Particle frames were optional before the atlas; a missing one becomes
+    // a plain white square rather than a load error.
+    auto addParticle = [&built](const std::string &name) {
+      sf::Image image;
+      if (!image.loadFromFile("assets/" + name + ".png"))
+        image.resize({8, 8}, sf::Color::White);
+      built.add(name, std::move(image));
+    };
+    for (int i = 0; i <= 7; ++i) {
+      addParticle("particle/generic_" + std::to_string(i));
+      addParticle("particle/potion/effect_" + std::to_string(i));
+    }
+
+    built.build();
+    return built;
+  }();
+  return atlas;
+}
@@ -0,0 +1,74 @@
+#ifndef OOP_TEXTUREATLAS_H
+#define OOP_TEXTUREATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A named sub-rectangle of one atlas page.
+struct AtlasRegion {
+  const sf::Texture *page = nullptr;
+  sf::IntRect rect;
+
+  // Points a sprite at this region, keeping its transform and colour.
+  void applyTo(sf::Sprite &sprite) const {
+    sprite.setTexture(*page);
+    sprite.setTextureRect(rect);
+  }
+};
+
+// Packs many small images into a few large textures so sprites that share
+// a page can be drawn without rebinding textures, and batched into one
+// vertex array. Images are queued with add() and packed by build() onto
+// shelves, tallest first. Each image is surrounded by `padding` pixels
+// that repeat its own edge pixels, so filtering or scaling never samples
+// a neighbour.
+class TextureAtlas {
+  struct Pending {
+    std::string name;
+    sf::Image image;
+  };
+
+  unsigned padding;
+  unsigned pageSize;
+  std::vector<Pending> pending;
+  std::vector<std::unique_ptr<sf::Texture>> pages; // stable addresses
+  std::unordered_map<std::string, AtlasRegion> regions;
+
+public:
+  explicit TextureAtlas(unsigned padding = 1, unsigned pageSize = 512);
+
+  TextureAtlas(const TextureAtlas &) = delete;
+  TextureAtlas &operator=(const TextureAtlas &) = delete;
+  TextureAtlas(TextureAtlas &&) = default;
+  TextureAtlas &operator=(TextureAtlas &&) = default;
+
+  // Queues an image file; throws AssetLoadException if it cannot be read.
+  void add(const std::string &name, const std::filesystem::path &path);
+
+  void add(const std::string &name, sf::Image image);
+
+  // Packs everything queued since the last build onto new pages. Throws
+  // AssetLoadException if an image does not fit on a page.
+  void build();
+
+  [[nodiscard]] bool contains(const std::string &name) const {
+    return regions.contains(name);
+  }
+
+  // Throws AssetLoadException for unknown names.
+  [[nodiscard]] const AtlasRegion &region(const std::string &name) const;
+
+  [[nodiscard]] std::size_t page_count() const { return pages.size(); }
+
+  // Glass, break stages, grid slots and tabs, cobweb, hearts, hunger and
+  // particle frames, packed on first use. Needs a live graphics context,
+  // so the first call has to come after the window is created.
+  static const TextureAtlas &game();
+};
+
+#endif // OOP_TEXTUREATLAS_H
@@ -0,0 +1,82 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+thread_local const ThreadPool *ThreadPool::current_pool = nullptr;
+thread_local std::size_t ThreadPool::current_index = 0;
+
+ThreadPool::ThreadPool(unsigned threads) {
+  const unsigned count = std::max(1u, threads);
+  queues.reserve(count);
+  for (unsigned i = 0; i < count; ++i)
+    queues.push_back(std::make_unique<Queue>());
+  workers.reserve(count);
+  for (unsigned i = 0; i < count; ++i)
+    workers.emplace_back([this, i] { run(i); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(sleep_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (auto &worker : workers)
+    worker.join();
+}
+
+void ThreadPool::submit(Task task) {
+  const std::size_t target = current_pool == this
+                                 ? current_index
+                                 : next_queue++ % queues.size();
+  {
+    std::lock_guard lock(queues[target]->mutex);
+    queues[target]->tasks.push_back(std::move(task));
+  }
+  {
+    // Taking the lock orders the increment against a worker about to sleep
+    std::lock_guard lock(sleep_mutex);
+    ++queued;
+  }
+  wake.notify_one();
+}
+
+bool ThreadPool::try_take(std::size_t self, Task &task) {
+  {
+    Queue &own = *queues[self];
+    std::lock_guard lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  for (std::size_t k = 1; k < queues.size(); ++k) {
+    Queue &victim = *queues[(self + k) % queues.size()];
+    std::lock_guard lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::run(std::size_t index) {
+  current_pool = this;
+  current_index = index;
+  Task task;
+  while (true) {
+    if (try_take(index, task)) {
+      --queued;
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex);
+    wake.wait(lock, [this] { return stopping || queued > 0; });
+    if (stopping && queued == 0)
+      return;
+  }
+}
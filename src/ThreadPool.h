@@ -0,0 +1,54 @@
+#ifndef OOP_THREADPOOL_H
+#define OOP_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads with one task deque each. A worker pushes and
+// pops at the back of its own deque (depth-first, cache-warm) and, when it
+// runs dry, steals from the front of the others, where the oldest and
+// usually largest pieces of work sit. Tasks submitted from outside the pool
+// are dealt round-robin.
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency());
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  void submit(Task task);
+
+  [[nodiscard]] std::size_t size() const { return workers.size(); }
+
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> next_queue{0};
+  std::atomic<int> queued{0};
+  std::mutex sleep_mutex;
+  std::condition_variable wake;
+  bool stopping = false;
+
+  static thread_local const ThreadPool *current_pool;
+  static thread_local std::size_t current_index;
+
+  bool try_take(std::size_t self, Task &task);
+  void run(std::size_t index);
+};
+
+#endif // OOP_THREADPOOL_H
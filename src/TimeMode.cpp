@@ -1,10 +1,12 @@
 
 #include "TimeMode.h"
-#include "Exceptions.h"
+#include "ResourceCache.h"
 
 TimeMode::TimeMode(std::unique_ptr<GameMode> mode, int gridSize)
     : GameModeDecorator(std::move(mode)), decayTimer(0.0f), timeLeft(0.0f),
-      totalTime(static_cast<float>(gridSize) * 15.0f), hurtSound(hurtBuffer) {
+      totalTime(static_cast<float>(gridSize) * 15.0f),
+      hurtBuffer(ResourceCache::shared().soundBuffer("assets/sound/hurt.mp3")),
+      hurtSound(*hurtBuffer) {
 
   maxHearts = 20;
 
@@ -20,10 +22,6 @@ TimeMode::TimeMode(std::unique_ptr<GameMode> mode, int gridSize)
 
   mistakes = 0;
   timeLeft = totalTime;
-
-  if (!hurtBuffer.loadFromFile("assets/sound/hurt.mp3")) {
-    throw AssetLoadException("assets/sound/hurt.mp3", "Sound");
-  }
 }
 
 void TimeMode::onBlockToggled(bool isCorrect, bool isCompleted,
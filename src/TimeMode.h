@@ -3,6 +3,7 @@
 
 #include "GameMode.h"
 #include <SFML/Audio.hpp>
+#include <memory>
 
 class TimeMode : public GameModeDecorator {
   float decayTimer;
@@ -11,7 +12,7 @@ class TimeMode : public GameModeDecorator {
   float decayInterval;
   int maxHearts;
 
-  sf::SoundBuffer hurtBuffer;
+  std::shared_ptr<const sf::SoundBuffer> hurtBuffer;
   sf::Sound hurtSound;
 
 public:
@@ -1,28 +1,30 @@
 #include "TorchMode.h"
 #include "AlchemyMode.h"
-#include "Exceptions.h"
+#include "AssetLoader.h"
+#include "ResourceCache.h"
 #include <random>
 
+namespace {
+std::string fireSoundPath(int i) {
+  return "assets/sound/fire" + std::to_string(i) + ".mp3";
+}
+} // namespace
+
 TorchMode::TorchMode(std::unique_ptr<GameMode> mode)
     : GameModeDecorator(std::move(mode)), fireSound(dummyBuffer),
       silenceTimer(0), inSilence(false) {
-  sf::SoundBuffer buffer;
-  if (!buffer.loadFromFile("assets/sound/fire1.mp3")) {
-    throw AssetLoadException("assets/sound/fire1.mp3", "Sound");
-  }
-  fireBuffers.push_back(buffer);
-  if (!buffer.loadFromFile("assets/sound/fire2.mp3")) {
-    throw AssetLoadException("assets/sound/fire2.mp3", "Sound");
-  }
-  fireBuffers.push_back(buffer);
-  if (!buffer.loadFromFile("assets/sound/fire3.mp3")) {
-    throw AssetLoadException("assets/sound/fire3.mp3", "Sound");
-  }
-  fireBuffers.push_back(buffer);
+  ResourceCache &cache = ResourceCache::shared();
+  for (int i = 1; i <= 3; ++i)
+    fireBuffers.push_back(cache.soundBuffer(fireSoundPath(i)));
 
   playNextFireSound();
 }
 
+void TorchMode::prefetch(AssetLoader &loader) {
+  for (int i = 1; i <= 3; ++i)
+    loader.addSoundBuffer(fireSoundPath(i));
+}
+
 std::unique_ptr<GameMode> TorchMode::clone() const {
   auto clonedWrapped = wrappedMode ? wrappedMode->clone() : nullptr;
   auto newMode = std::make_unique<TorchMode>(std::move(clonedWrapped));
@@ -60,7 +62,7 @@ void TorchMode::playNextFireSound() {
                                       static_cast<int>(fireBuffers.size()) - 1);
 
   int index = dis(gen);
-  fireSound.setBuffer(fireBuffers[index]);
+  fireSound.setBuffer(*fireBuffers[index]);
   fireSound.setVolume(100.0f); // Increased volume
   fireSound.play();
 }
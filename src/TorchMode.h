@@ -5,12 +5,17 @@
 #include "ParticleSystem.h"
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <optional>
 #include <vector>
 
+class AssetLoader;
+
 class TorchMode : public GameModeDecorator {
 public:
   explicit TorchMode(std::unique_ptr<GameMode> mode);
+  // Queues the fire crackle, which starts as soon as the mode does.
+  static void prefetch(AssetLoader &loader);
   TorchMode(const TorchMode &other) = delete;
   ~TorchMode() override = default;
 
@@ -29,7 +34,7 @@ private:
   mutable sf::Texture lightTexture;
   mutable bool lightTextureCreated = false;
 
-  std::vector<sf::SoundBuffer> fireBuffers;
+  std::vector<std::shared_ptr<const sf::SoundBuffer>> fireBuffers;
   sf::SoundBuffer dummyBuffer;
   sf::Sound fireSound;
 
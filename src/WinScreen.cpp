@@ -1,23 +1,17 @@
 #include "WinScreen.h"
 #include "Exceptions.h"
-#include "ShadowedText.h"
+#include "ResourceCache.h"
 #include <fstream>
 #include <iostream>
 
-WinScreen::WinScreen() : scrollOffset(0.0f), fadeAlpha(255.0f), clock(), speedMultiplier(1.0f) {
-  if (!font.openFromFile("assets/Monocraft.ttf")) {
-    throw AssetLoadException("assets/Monocraft.ttf", "Font");
-  }
-
-  if (!backgroundTexture.loadFromFile("assets/End_Poem_background.png")) {
-    throw AssetLoadException("assets/End_Poem_background.png", "Texture");
-  }
-  backgroundSprite.emplace(backgroundTexture);
-
-  if (!logoTexture.loadFromFile("assets/pictocraft.png")) {
-    throw AssetLoadException("assets/pictocraft.png", "Texture");
-  }
-  logoSprite.emplace(logoTexture);
+WinScreen::WinScreen()
+    : font(ResourceCache::shared().font("assets/Monocraft.ttf")),
+      backgroundTexture(
+          ResourceCache::shared().texture("assets/End_Poem_background.png")),
+      logoTexture(ResourceCache::shared().texture("assets/pictocraft.png")),
+      scrollOffset(0.0f), fadeAlpha(255.0f), clock(), speedMultiplier(1.0f) {
+  backgroundSprite.emplace(*backgroundTexture);
+  logoSprite.emplace(*logoTexture);
 
   loadPoemText();
 }
@@ -25,8 +19,7 @@ WinScreen::WinScreen() : scrollOffset(0.0f), fadeAlpha(255.0f), clock(), speedMu
 WinScreen::~WinScreen() = default;
 
 void WinScreen::loadPoemText() {
-  paragraphs.clear();
-  paragraphColors.clear();
+  poemText.clear();
   std::ifstream file("assets/poem.txt");
   if (!file.is_open()) {
     throw AssetLoadException("assets/poem.txt", "File");
@@ -39,8 +32,8 @@ void WinScreen::loadPoemText() {
   while (std::getline(file, line)) {
     if (line.empty()) {
       if (!currentParagraph.empty()) {
-        paragraphs.push_back(currentParagraph);
-        paragraphColors.push_back(useCyan ? sf::Color::Cyan : sf::Color::Green);
+        poemText.emplace_back(*font, currentParagraph);
+        poemText.back().setFillColor(useCyan ? sf::Color::Cyan : sf::Color::Green);
         useCyan = !useCyan;
         currentParagraph.clear();
       }
@@ -53,8 +46,8 @@ void WinScreen::loadPoemText() {
   }
 
   if (!currentParagraph.empty()) {
-    paragraphs.push_back(currentParagraph);
-    paragraphColors.push_back(useCyan ? sf::Color::Cyan : sf::Color::Green);
+    poemText.emplace_back(*font, currentParagraph);
+    poemText.back().setFillColor(useCyan ? sf::Color::Cyan : sf::Color::Green);
   }
 
   file.close();
@@ -70,6 +63,15 @@ void WinScreen::reset() {
 void WinScreen::setScore(int score, const Leaderboard& leaderboard) {
   finalScore = score;
   topScores = leaderboard.getEntries();
+
+  scoreText.setString("Final Score: " + std::to_string(finalScore));
+  scoreText.setFillColor(sf::Color::Yellow);
+  leaderboardHeader.setFillColor(sf::Color::Cyan);
+  leaderboardText.clear();
+  for (const auto &entry : topScores) {
+    leaderboardText.emplace_back(
+        *font, entry.name + " ........ " + std::to_string(entry.score));
+  }
   loadPoemText();
 }
 
@@ -95,9 +97,9 @@ void WinScreen::draw(sf::RenderWindow &window) {
   backgroundSprite->setColor(sf::Color(255, 255, 255, alpha));
 
   float bgScaleX = static_cast<float>(winSize.x) /
-                   static_cast<float>(backgroundTexture.getSize().x);
+                   static_cast<float>(backgroundTexture->getSize().x);
   float bgScaleY = static_cast<float>(winSize.y) /
-                   static_cast<float>(backgroundTexture.getSize().y);
+                   static_cast<float>(backgroundTexture->getSize().y);
   backgroundSprite->setScale({bgScaleX, bgScaleY});
 
   window.draw(*backgroundSprite);
@@ -122,39 +124,35 @@ void WinScreen::draw(sf::RenderWindow &window) {
   currentY += logoBounds.size.y * logoScale + 80.0f * scale;
 
   // Draw Score
-  sf::Text scoreText(font, "Final Score: " + std::to_string(finalScore));
   scoreText.setCharacterSize(static_cast<unsigned int>(40.0f * scale));
-  scoreText.setFillColor(sf::Color::Yellow);
+  scoreText.setShadowScale(scale);
   auto scoreBounds = scoreText.getLocalBounds();
   float scoreX = (static_cast<float>(winSize.x) - scoreBounds.size.x) / 2.0f -
                  scoreBounds.position.x;
   scoreText.setPosition({scoreX, currentY});
 
   if (currentY > -scoreBounds.size.y && currentY < static_cast<float>(winSize.y)) {
-    ShadowedText::draw(window, scoreText, scale);
+    window.draw(scoreText);
   }
 
   currentY += scoreBounds.size.y + 20.0f * scale;
 
   // Draw Leaderboard
-  if (!topScores.empty()) {
-      sf::Text lbHeader(font, "=== LEADERBOARD ===");
-      lbHeader.setCharacterSize(static_cast<unsigned int>(30.0f * scale));
-      lbHeader.setFillColor(sf::Color::Cyan);
-      auto lbHeaderBounds = lbHeader.getLocalBounds();
-      lbHeader.setPosition({(static_cast<float>(winSize.x) - lbHeaderBounds.size.x) / 2.0f, currentY});
-      ShadowedText::draw(window, lbHeader, scale);
+  if (!leaderboardText.empty()) {
+      leaderboardHeader.setCharacterSize(static_cast<unsigned int>(30.0f * scale));
+      leaderboardHeader.setShadowScale(scale);
+      auto lbHeaderBounds = leaderboardHeader.getLocalBounds();
+      leaderboardHeader.setPosition({(static_cast<float>(winSize.x) - lbHeaderBounds.size.x) / 2.0f, currentY});
+      window.draw(leaderboardHeader);
       
       currentY += lbHeaderBounds.size.y + 20.0f * scale;
       
-      for (const auto& entry : topScores) {
-          std::string line = entry.name + " ........ " + std::to_string(entry.score);
-          sf::Text entryText(font, line);
+      for (auto &entryText : leaderboardText) {
           entryText.setCharacterSize(static_cast<unsigned int>(24.0f * scale));
-          entryText.setFillColor(sf::Color::White);
+          entryText.setShadowScale(scale);
           auto entryBounds = entryText.getLocalBounds();
           entryText.setPosition({(static_cast<float>(winSize.x) - entryBounds.size.x) / 2.0f, currentY});
-          ShadowedText::draw(window, entryText, scale);
+          window.draw(entryText);
           currentY += entryBounds.size.y + 10.0f * scale;
       }
       currentY += 40.0f * scale;
@@ -164,11 +162,9 @@ void WinScreen::draw(sf::RenderWindow &window) {
 
   auto fontSize = static_cast<unsigned int>(24.0f * scale);
 
-  for (size_t i = 0; i < paragraphs.size(); ++i) {
-    sf::Text text(font);
-    text.setString(paragraphs[i]);
+  for (auto &text : poemText) {
     text.setCharacterSize(fontSize);
-    text.setFillColor(paragraphColors[i]);
+    text.setShadowScale(scale);
 
     auto bounds = text.getLocalBounds();
     float textX = (static_cast<float>(winSize.x) - bounds.size.x) / 2.0f -
@@ -176,7 +172,7 @@ void WinScreen::draw(sf::RenderWindow &window) {
     text.setPosition({textX, currentY});
 
     if (currentY > -bounds.size.y && currentY < static_cast<float>(winSize.y)) {
-      ShadowedText::draw(window, text, scale);
+      window.draw(text);
     }
 
     currentY += bounds.size.y + 40.0f * scale;
@@ -2,20 +2,26 @@
 #define OOP_WINSCREEN_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 #include "Leaderboard.h"
+#include "ShadowedText.h"
 
 class WinScreen {
-  sf::Font font;
-  sf::Texture backgroundTexture;
+  std::shared_ptr<const sf::Font> font;
+  std::shared_ptr<const sf::Texture> backgroundTexture;
   std::optional<sf::Sprite> backgroundSprite;
-  sf::Texture logoTexture;
+  std::shared_ptr<const sf::Texture> logoTexture;
   std::optional<sf::Sprite> logoSprite;
 
-  std::vector<std::string> paragraphs;
-  std::vector<sf::Color> paragraphColors;
+  // Built when the poem or the score changes; draw() only resizes and
+  // moves them as the credits scroll.
+  std::vector<ShadowedText> poemText;
+  ShadowedText scoreText{*font};
+  ShadowedText leaderboardHeader{*font, "=== LEADERBOARD ==="};
+  std::vector<ShadowedText> leaderboardText;
 
   float scrollOffset;
   float fadeAlpha;
@@ -1,33 +1,22 @@
 #include "XPBar.h"
-#include "Exceptions.h"
+#include "ResourceCache.h"
 #include <sstream>
 #include <iostream>
 #include <algorithm>
 #include <cmath>
 
-XPBar::XPBar() : backgroundSprite(backgroundTexture), progressSprite(progressTexture) {
-    if (!backgroundTexture.loadFromFile("assets/xp/experience_bar_background.png")) {
-        throw AssetLoadException("assets/xp/experience_bar_background.png", "Texture");
-    } else {
-        backgroundSprite.setTexture(backgroundTexture);
-    }
-    if (!progressTexture.loadFromFile("assets/xp/experience_bar_progress.png")) {
-        throw AssetLoadException("assets/xp/experience_bar_progress.png", "Texture");
-    } else {
-        progressSprite.setTexture(progressTexture);
-    }
-    
-    if (!font.openFromFile("assets/Monocraft.ttf")) {
-        throw AssetLoadException("assets/Monocraft.ttf", "Font");
-    }
-}
+XPBar::XPBar()
+    : backgroundTexture(ResourceCache::shared().texture("assets/xp/experience_bar_background.png")),
+      progressTexture(ResourceCache::shared().texture("assets/xp/experience_bar_progress.png")),
+      backgroundSprite(*backgroundTexture), progressSprite(*progressTexture),
+      font(ResourceCache::shared().font("assets/Monocraft.ttf")) {}
 
-void XPBar::drawOutlinedText(sf::RenderWindow& window, const std::string& text,
+void XPBar::drawOutlinedText(sf::RenderTarget& target, const std::string& text,
                               const sf::Vector2f& position, unsigned int fontSize,
                               sf::Color fillColor, sf::Color outlineColor, float outlineThickness) const {
-    const_cast<sf::Texture&>(font.getTexture(fontSize)).setSmooth(false);
+    const_cast<sf::Texture&>(font->getTexture(fontSize)).setSmooth(false);
 
-    sf::Text textObj(font, text, fontSize);
+    sf::Text textObj(*font, text, fontSize);
     
     auto bounds = textObj.getLocalBounds();
     textObj.setOrigin({std::floor(bounds.position.x + bounds.size.x / 2.f),
@@ -44,16 +33,16 @@ void XPBar::drawOutlinedText(sf::RenderWindow& window, const std::string& text,
     float baseY = std::floor(position.y);
     
     textObj.setPosition({baseX, baseY});
-    window.draw(textObj);
+    target.draw(textObj);
 }
 
-void XPBar::draw(sf::RenderWindow& window, int score, const sf::Vector2f& position, float scale) {
-    auto bgSize = backgroundTexture.getSize();
-    auto progSize = progressTexture.getSize();
+void XPBar::draw(sf::RenderTarget& target, int score, const sf::Vector2f& position, float scale) {
+    auto bgSize = backgroundTexture->getSize();
+    auto progSize = progressTexture->getSize();
     
     if (bgSize.x == 0 || bgSize.y == 0) return;
     
-    int displayScore = score / 100;
+    int displayScore = levelFor(score);
     
     float progress = static_cast<float>(displayScore % 10) / 10.f;
     
@@ -64,7 +53,7 @@ void XPBar::draw(sf::RenderWindow& window, int score, const sf::Vector2f& positi
         backgroundSprite.setScale({scale, scale});
         backgroundSprite.setOrigin({static_cast<float>(bgSize.x) / 2.f, static_cast<float>(bgSize.y) / 2.f});
         backgroundSprite.setPosition(position);
-        window.draw(backgroundSprite);
+        target.draw(backgroundSprite);
     }
     
 
@@ -80,7 +69,7 @@ void XPBar::draw(sf::RenderWindow& window, int score, const sf::Vector2f& positi
         progressSprite.setOrigin({0.f, static_cast<float>(progSize.y) / 2.f});
         
         progressSprite.setPosition({leftEdge, position.y});
-        window.draw(progressSprite);
+        target.draw(progressSprite);
     }
     
     if (true) {
@@ -93,7 +82,7 @@ void XPBar::draw(sf::RenderWindow& window, int score, const sf::Vector2f& positi
         
         sf::Vector2f textPos = {position.x, textY};
         
-        drawOutlinedText(window, oss.str(), textPos, fontSize, 
+        drawOutlinedText(target, oss.str(), textPos, fontSize, 
                          sf::Color(127, 255, 0), sf::Color::Black, 1.f * scale);
     }
 }
@@ -2,22 +2,26 @@
 #define XP_BAR_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class XPBar {
-    sf::Texture backgroundTexture;
-    sf::Texture progressTexture;
+    std::shared_ptr<const sf::Texture> backgroundTexture;
+    std::shared_ptr<const sf::Texture> progressTexture;
     sf::Sprite backgroundSprite;
     sf::Sprite progressSprite;
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font;
 
 public:
     XPBar();
 
-    void draw(sf::RenderWindow& window, int score, const sf::Vector2f& position, float scale);
+    // The level shown for a score; the bar fills over ten levels.
+    static int levelFor(int score) { return score / 100; }
+
+    void draw(sf::RenderTarget& target, int score, const sf::Vector2f& position, float scale);
     
 private:
 
-    void drawOutlinedText(sf::RenderWindow& window, const std::string& text,
+    void drawOutlinedText(sf::RenderTarget& target, const std::string& text,
                           const sf::Vector2f& position, unsigned int fontSize,
                           sf::Color fillColor, sf::Color outlineColor, float outlineThickness) const;
 };